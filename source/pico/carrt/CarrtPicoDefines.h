@@ -61,6 +61,77 @@
     #define CARRTPICO_ENCODER_RIGHT_GPIO 14    // GPIO14, Pin 19
 #endif                                         // CARRTPICO_ENCODER_RIGHT_GPIO
 
+// The PIO block whose state machines count encoder edges (one per encoder)
+#ifndef CARRTPICO_ENCODER_PIO
+    #define CARRTPICO_ENCODER_PIO pio0
+#endif    // CARRTPICO_ENCODER_PIO
+
+// How long (1-32 us) an encoder level must hold to count as an edge
+#ifndef CARRTPICO_ENCODER_GLITCH_FILTER_US
+    #define CARRTPICO_ENCODER_GLITCH_FILTER_US 20
+#endif    // CARRTPICO_ENCODER_GLITCH_FILTER_US
+
+// How often Core1 collects encoder edges from the PIO; each FIFO holds
+// 8 edges, so this allows for up to 4000 edges/sec per encoder
+#ifndef CARRTPICO_ENCODER_SAMPLE_US
+    #define CARRTPICO_ENCODER_SAMPLE_US 2000
+#endif    // CARRTPICO_ENCODER_SAMPLE_US
+
+// **************************************************************
+
+// Impact detection (RPi0 can change the thresholds with an ImpactControlMsg).
+// While driving, check every 10 ms (the BNO055 fuses at 100 Hz).
+#ifndef CARRTPICO_IMPACT_CHECK_US
+    #define CARRTPICO_IMPACT_CHECK_US 10000
+#endif    // CARRTPICO_IMPACT_CHECK_US
+
+// Horizontal linear accel that counts as hitting something (raw BNO055,
+// 100 LSB = 1 m/s^2)
+#ifndef CARRTPICO_IMPACT_ACCEL_THRESHOLD
+    #define CARRTPICO_IMPACT_ACCEL_THRESHOLD 800
+#endif    // CARRTPICO_IMPACT_ACCEL_THRESHOLD
+
+// A wheel with no encoder edges for this long while driving has stalled
+#ifndef CARRTPICO_IMPACT_STALL_MS
+    #define CARRTPICO_IMPACT_STALL_MS 400
+#endif    // CARRTPICO_IMPACT_STALL_MS
+
+// **************************************************************
+
+// Memory watch (see MemoryMonitor): how often MainProcess looks, and the
+// headroom below which the Pico reports a fatal error and resets rather
+// than wait to run out
+#ifndef CARRTPICO_MEMORY_CHECK_MS
+    #define CARRTPICO_MEMORY_CHECK_MS 1000
+#endif    // CARRTPICO_MEMORY_CHECK_MS
+
+#ifndef CARRTPICO_MIN_FREE_HEAP
+    #define CARRTPICO_MIN_FREE_HEAP 4096
+#endif    // CARRTPICO_MIN_FREE_HEAP
+
+#ifndef CARRTPICO_MIN_FREE_STACK
+    #define CARRTPICO_MIN_FREE_STACK 256
+#endif    // CARRTPICO_MIN_FREE_STACK
+
+// **************************************************************
+
+// Saved configuration (see ConfigStore): the flash sector it lives in (by
+// default the last 4 kB of flash; must not overlap the program), how long
+// the config must hold steady before it is written, and how long the
+// serial link must have been quiet first (writing flash stops both cores,
+// so anything more than the UART's 32 byte RX FIFO arriving then is lost)
+#ifndef CARRTPICO_CONFIG_FLASH_OFFSET
+    #define CARRTPICO_CONFIG_FLASH_OFFSET ( PICO_FLASH_SIZE_BYTES - 4096 )
+#endif    // CARRTPICO_CONFIG_FLASH_OFFSET
+
+#ifndef CARRTPICO_CONFIG_SAVE_DELAY_MS
+    #define CARRTPICO_CONFIG_SAVE_DELAY_MS 2000
+#endif    // CARRTPICO_CONFIG_SAVE_DELAY_MS
+
+#ifndef CARRTPICO_CONFIG_SAVE_QUIET_MS
+    #define CARRTPICO_CONFIG_SAVE_QUIET_MS 500
+#endif    // CARRTPICO_CONFIG_SAVE_QUIET_MS
+
 // **************************************************************
 
 // Define the GPIO pin for the IC (PowerBoost) battery
@@ -83,6 +154,30 @@
     #define CARRTPICO_MOTOR_BATTERY_ADC 0    // GPIO26, ADC0, Pin 31
 #endif                                       // CARRTPICO_MOTOR_BATTERY_ADC
 
+// Rate the ADC samples the batteries (total for both; the ADC clock
+// divider limits this to 733 Hz - 500 kHz)
+#ifndef CARRTPICO_BATTERY_SAMPLE_HZ
+    #define CARRTPICO_BATTERY_SAMPLE_HZ 1000
+#endif    // CARRTPICO_BATTERY_SAMPLE_HZ
+
+// Low battery thresholds (filtered); a battery that went low has to come
+// back above its OK level before it can be reported low again
+#ifndef CARRTPICO_IC_BATTERY_LOW_MV
+    #define CARRTPICO_IC_BATTERY_LOW_MV 3500    // 1S LiPo
+#endif                                          // CARRTPICO_IC_BATTERY_LOW_MV
+
+#ifndef CARRTPICO_IC_BATTERY_OK_MV
+    #define CARRTPICO_IC_BATTERY_OK_MV 3650
+#endif    // CARRTPICO_IC_BATTERY_OK_MV
+
+#ifndef CARRTPICO_MOTOR_BATTERY_LOW_MV
+    #define CARRTPICO_MOTOR_BATTERY_LOW_MV 6600    // 1.1V per AA cell
+#endif                                             // CARRTPICO_MOTOR_BATTERY_LOW_MV
+
+#ifndef CARRTPICO_MOTOR_BATTERY_OK_MV
+    #define CARRTPICO_MOTOR_BATTERY_OK_MV 7000
+#endif    // CARRTPICO_MOTOR_BATTERY_OK_MV
+
 // **************************************************************
 
 // I2C defines to Pico's I2C network
@@ -104,6 +199,18 @@
     #define CARRTPICO_I2C_SCL 9
 #endif    // CARRTPICO_I2C_SCL
 
+// Max number of I2C transfers waiting to run (must be a power of 2)
+#ifndef CARRTPICO_I2C_TRANSFER_QUEUE_SIZE
+    #define CARRTPICO_I2C_TRANSFER_QUEUE_SIZE 8
+#endif    // CARRTPICO_I2C_TRANSFER_QUEUE_SIZE
+
+// Longest any one I2C write or read (blocking or submitted), or a wait for
+// the bus to go idle, may take before it counts as failed (the 34 byte nav
+// burst read takes about 1 ms at 400 kHz)
+#ifndef CARRTPICO_I2C_TIMEOUT_US
+    #define CARRTPICO_I2C_TIMEOUT_US 10000
+#endif    // CARRTPICO_I2C_TIMEOUT_US
+
 // **************************************************************
 
 // BNO055 related defines (I2C network address, etc)
@@ -112,6 +219,17 @@
     #define CARRT_BNO0555_I2C_ADDR 0x28
 #endif    // CARRT_BNO0555_I2C_ADDR
 
+// How often Core1 reads the BNO055 (it fuses at 100 Hz) for NavSampler
+#ifndef CARRTPICO_NAV_SAMPLE_US
+    #define CARRTPICO_NAV_SAMPLE_US 10000
+#endif    // CARRTPICO_NAV_SAMPLE_US
+
+// Older NavSampler samples than this don't count (Core1 stopped sampling,
+// or Core0 has been holding the bus)
+#ifndef CARRTPICO_NAV_SAMPLE_MAX_AGE_US
+    #define CARRTPICO_NAV_SAMPLE_MAX_AGE_US ( 3 * CARRTPICO_NAV_SAMPLE_US )
+#endif    // CARRTPICO_NAV_SAMPLE_MAX_AGE_US
+
 // **************************************************************
 
 // UART defines for the serial-link between RPi0 and Pico
@@ -139,15 +257,14 @@
 #define CORE1_SUCCESS 1'234
 #define CORE1_FAILURE 21
 
+// Must be a power of 2
 #define SIZE_OF_CORE0_TO_CORE1_QUEUE 8
 
-// **************************************************************
-
-// Debounce time for button presses
-
-// In milliseconds (value 10 seems to work well)
-#ifndef PICO_GPIO_DEBOUNCE_TIME
-    #define PICO_GPIO_DEBOUNCE_TIME 10
-#endif    // PICO_GPIO_DEBOUNCE_TIME
+// Max number of events Core1 can have scheduled at once (one-shot or
+// periodic); the Core1 alarm pool is sized to match (+3 for the base
+// timer and the encoder and nav sampling timers)
+#ifndef CORE1_MAX_SCHEDULED_EVENTS
+    #define CORE1_MAX_SCHEDULED_EVENTS 16
+#endif    // CORE1_MAX_SCHEDULED_EVENTS
 
 #endif    // CarrtPicoDefines_h
@@ -19,7 +19,6 @@
 */
 
 #include "BNO055.h"
-#include "Batteries.h"
 #include "BuildInfo.h"
 #include "CarrtError.h"
 #include "CarrtPicoDefines.h"
@@ -33,8 +32,10 @@
 #include "EventManager.h"
 #include "EventProcessor.h"
 #include "HeartBeatLed.h"
-#include "I2C.h"
+#include "ImpactDetector.h"
 #include "MainProcess.h"
+#include "MemoryMonitor.h"
+#include "NavRate.h"
 #include "OutputUtils.hpp"
 #include "PicoState.h"
 #include "SerialLinkPico.h"
@@ -84,10 +85,14 @@ namespace
     void setupMessageProcessor( SerialMessageProcessor& smp );
     void setupEventProcessor( EventProcessor& ep );
     void sendReady( SerialLinkPico& link );
-}    // namespace
+    [[noreturn]] void runCarrtPico( SerialLinkPico& rpi0 );
+    [[noreturn]] void freezeUntilReset( SerialLinkPico& rpi0 );
 
-constexpr int kSerialMessageHandlerReserveSize = 24;
-constexpr int kEventHandlerReserveSize = 20;
+#if !CARRTPICO_ENABLE_EXCEPTIONS
+    // Where carrtFatalError() reports (once main() has opened the link)
+    SerialLinkPico* sFatalErrorLink{ nullptr };
+#endif    // !CARRTPICO_ENABLE_EXCEPTIONS
+}    // namespace
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -101,39 +106,11 @@ int main()
     // Open the serial link to RPi0
     SerialLinkPico rpi0;
 
+#if CARRTPICO_ENABLE_EXCEPTIONS
+
     try
     {
-        initializeFailableHardware();
-
-        output2cout( "CARRT Pico started, hardware initialized, both cores running." );
-        output2cout( "CARRT Pico version", CarrtPicoVersion::versionStr(), "with features",
-                     CarrtPicoVersion::features() );
-        output2cout( "CARRT Pico build date", CarrtPicoVersion::buildDate(),
-                     CarrtPicoVersion::buildTime() );
-        output2cout( "CARRT Pico Git Hash", CarrtPicoVersion::hashFull() );
-        output2cout( "CARRT Pico Git Hash (short)", CarrtPicoVersion::hashShort() );
-        if ( CarrtPicoVersion::buildIsDirty() )
-        {
-            output2cout( "WARNING: CARRT Pico build is DIRTY" );
-        }
-
-        // Set up message processor
-        SerialMessageProcessor smp( kSerialMessageHandlerReserveSize, rpi0 );
-        setupMessageProcessor( smp );
-
-        // Set up event processor
-        EventProcessor ep( kEventHandlerReserveSize );
-        setupEventProcessor( ep );
-
-        // Report we are started and ready to receive messages
-        sendReady( rpi0 );
-
-        // Default starting values
-        // (at least for now while testing, RPi0 can change these via msg)
-        // TODO: Perhaps eventual make this allMsgsSendOff()
-        PicoState::allMsgsSendOn();
-
-        MainProcess::runMainEventLoop( Events(), ep, smp, rpi0 );
+        runCarrtPico( rpi0 );
     }
 
     catch ( const CarrtError& e )
@@ -165,38 +142,43 @@ int main()
         output2cout( "Fatal error of unknown type" );
     }
 
-    // From this point, recovering from serious error we can't handle
-    // No matter what, this proceess ends in resetting Pico
+#else
 
-    output2cout( "Pico frozen and displaying fast LED strobe" );
+    // Errors don't come back here; raiseCarrtError() reports them
+    // through this link (see carrtFatalError() below)
+    sFatalErrorLink = &rpi0;
+    runCarrtPico( rpi0 );
 
-    // Just spin and put HeartBeatLed on fast strobe
-    constexpr int kWaitTimeInMin{ 1 };
-    for ( int i{ 0 }; i < kWaitTimeInMin * 60 * 10; ++i )
-    {
-        Clock::sleep( 100ms );
-        HeartBeatLed::toggle();
+#endif    // CARRTPICO_ENABLE_EXCEPTIONS
 
-        // See if we get a sent a reset message
-        if ( rpi0.isReadable() )
-        {
-            auto msgType = rpi0.getMsgType();
-            if ( msgType && *msgType == MsgId::kResetPicoMsg )
-            {
-                PicoReset::reset( rpi0 );
-            }
-        }
+    freezeUntilReset( rpi0 );
+}
 
-        // If no reset msg, we keep strobing the LED
+#if !CARRTPICO_ENABLE_EXCEPTIONS
+
+void carrtFatalError( int errCode, const char* what ) noexcept
+{
+    static bool inFatalError{ false };
+
+    if ( !sFatalErrorLink || inFatalError )
+    {
+        // Failed before the link was open, or while reporting
+        output2cout( "Fatal error", errCode, what );
+        PicoReset::fatalReset();
     }
+    inFatalError = true;
+
+    // Same report main() sends for a caught CarrtError
+    ErrorReportMsg err( kPicoFatalError, errCode, Clock::millis() );
+    err.sendOut( *sFatalErrorLink );
 
-    // If we get here, just force reset
-    output2cout( "Fatal reset" );
-    PicoReset::fatalReset();
+    output2cout( "Fatal error", errCode, what );
 
-    return 0;
+    freezeUntilReset( *sFatalErrorLink );
 }
 
+#endif    // !CARRTPICO_ENABLE_EXCEPTIONS
+
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace
@@ -206,6 +188,9 @@ namespace
     {
         // Nothing in this function throws or even fails
 
+        // Before Core1 starts using its stack
+        MemoryMonitor::paintStacks();
+
 #if USE_CARRTPICO_STDIO
         // Initialize C/C++ stdio (used for status output and debugging)
         stdio_init_all();
@@ -214,16 +199,11 @@ namespace
         // Initialize state
         PicoState::initialize();
 
-        // Set up Pico's I2C (to talk with BNO055)
-        I2C::initI2C();
-
         // Initialize the heartbeat LED
         HeartBeatLed::initialize();
 
-        // The encoders are set up on Core1
-
-        // Initialize ADC for batteries
-        Batteries::initBatteries();
+        // I2C (to talk with the BNO055), the encoders, and the battery ADC
+        // are set up on Core1
     }
 
     void initializeFailableHardware()
@@ -239,9 +219,23 @@ namespace
         // Note future b/c BNO055 needs nearly 1 sec to be ready to accept I2C.
         Core1::queueEventForCore1( EvtId::kBNO055InitializeEvent, BNO055::kWaitAfterPowerOnReset );
 
+        // Core1 sets up I2C (long before the BNO055 is ready), so transfers
+        // finish under interrupt on the core that samples the BNO055
+        Core1::queueEventForCore1( EvtId::kInitI2C );
+
         // Tell Core1 to initialize the encoders
         // Core1 does it so the interrupts go to Core1
         Core1::queueEventForCore1( EvtId::kInitEncoders );
+
+        // Same for the battery ADC (its DMA interrupt goes to Core1)
+        Core1::queueEventForCore1( EvtId::kInitBatteries );
+
+        // Start the nav update tick and impact detection with the saved
+        // settings, if any (RPi0 can change them later)
+        PicoState::Config config{ PicoState::getConfig() };
+        NavRate::setRate( config.mNavRateHz );
+        ImpactDetector::configure( config.mImpactEnabled, config.mImpactAccelThreshold,
+                                   config.mImpactStallMs );
     }
 
     // Debug/test might not call (e.g., use smp in DumpByte mode)
@@ -258,6 +252,7 @@ namespace
         // smp.registerMessage<PicoSaysStopMsg>( MsgId::kPicoSaysStop );
         smp.registerMessage<MsgControlMsg>( MsgId::kMsgControlMsg );
         smp.registerMessage<ResetPicoMsg>( MsgId::kResetPicoMsg );
+        smp.registerMessage<ResetPicoConfigMsg>( MsgId::kResetPicoConfig );
         // smp.registerMessage<TimerEventMsg>( MsgId::kTimerEventMsg );
         smp.registerMessage<TimerControlMsg>( MsgId::kTimerControl );
         smp.registerMessage<BeginCalibrationMsg>( MsgId::kBeginCalibration );
@@ -265,13 +260,21 @@ namespace
         // smp.registerMessage<CalibrationInfoUpdateMsg>( MsgId::kCalibrationInfoUpdate );
         smp.registerMessage<SetAutoCalibrateMsg>( MsgId::kSetAutoCalibrate );
         smp.registerMessage<ResetBNO055Msg>( MsgId::kResetBNO055 );
+        smp.registerMessage<CalibrationProfileMsg>( MsgId::kCalibrationProfile );
         // smp.registerMessage<NavUpdateMsg>( MsgId::kTimerNavUpdate );
+        // smp.registerMessage<ExtendedNavUpdateMsg>( MsgId::kExtendedNavUpdate );
+        // smp.registerMessage<PoseUpdateMsg>( MsgId::kPoseUpdate );
         smp.registerMessage<NavUpdateControlMsg>( MsgId::kNavUpdateControl );
+        smp.registerMessage<NavRateControlMsg>( MsgId::kNavRateControl );
         smp.registerMessage<DrivingStatusUpdateMsg>( MsgId::kDrivingStatusUpdate );
+        smp.registerMessage<ImpactControlMsg>( MsgId::kImpactControl );
         // smp.registerMessage<EncoderUpdateMsg>( MsgId::kEncoderUpdate );
         smp.registerMessage<EncoderUpdateControlMsg>( MsgId::kEncoderUpdateControl );
         smp.registerMessage<BatteryLevelRequestMsg>( MsgId::kBatteryLevelRequest );
         // smp.registerMessage<BatteryLevelUpdateMsg>( MsgId::kBatteryLevelUpdate );
+        smp.registerMessage<EventStatsRequestMsg>( MsgId::kEventStatsRequest );
+        // smp.registerMessage<EventStatsMsg>( MsgId::kEventStats );
+        // smp.registerMessage<MemoryStatsMsg>( MsgId::kMemoryStats );
         // smp.registerMessage<ErrorReportMsg>( MsgId::kErrorReportFromPico );
         smp.registerMessage<TestPicoErrorRptMsg>( MsgId::kTestPicoReportError );
         smp.registerMessage<TestPicoMessagesMsg>( MsgId::kTestPicoMessages );
@@ -289,12 +292,19 @@ namespace
 
         ep.registerHandler<NavUpdateHandler>( EvtId::kNavUpdateEvent );
         ep.registerHandler<InitializeBNO055Handler>( EvtId::kBNO055InitializeEvent );
+        ep.registerHandler<BNO055InitFinishedHandler>( EvtId::kBNO055InitFinishedEvent );
         ep.registerHandler<BNO055ResetHandler>( EvtId::kBNO055ResetEvent );
         ep.registerHandler<BeginCalibrationHandler>( EvtId::kBNO055BeginCalibrationEvent );
         ep.registerHandler<SendCalibrationInfoHandler>( EvtId::kSendCalibrationInfoEvent );
+        ep.registerHandler<BNO055ProfileReadHandler>( EvtId::kBNO055ProfileReadEvent );
+        ep.registerHandler<BNO055ProfileDoneHandler>( EvtId::kBNO055ProfileDoneEvent );
+
+        ep.registerHandler<ImpactCheckHandler>( EvtId::kImpactCheckEvent );
 
         ep.registerHandler<PulsePicoLedHandler>( EvtId::kPulsePicoLedEvent );
 
+        ep.registerHandler<BatteryLowHandler>( EvtId::kBatteryLowEvent );
+
         ep.registerHandler<PicoResetHandler>( EvtId::kPicoResetEvent );
 
         ep.registerHandler<ErrorEventHandler>( EvtId::kErrorEvent );
@@ -309,4 +319,75 @@ namespace
         output2cout( "CARRT Pico is ready" );
     }
 
+    [[noreturn]] void runCarrtPico( SerialLinkPico& rpi0 )
+    {
+        initializeFailableHardware();
+
+        output2cout( "CARRT Pico started, hardware initialized, both cores running." );
+        output2cout( "CARRT Pico version", CarrtPicoVersion::versionStr(), "with features",
+                     CarrtPicoVersion::features() );
+        output2cout( "CARRT Pico build date", CarrtPicoVersion::buildDate(),
+                     CarrtPicoVersion::buildTime() );
+        output2cout( "CARRT Pico Git Hash", CarrtPicoVersion::hashFull() );
+        output2cout( "CARRT Pico Git Hash (short)", CarrtPicoVersion::hashShort() );
+        if ( CarrtPicoVersion::buildIsDirty() )
+        {
+            output2cout( "WARNING: CARRT Pico build is DIRTY" );
+        }
+
+        // Set up message processor
+        SerialMessageProcessor smp( rpi0 );
+        setupMessageProcessor( smp );
+
+        // Set up event processor
+        EventProcessor ep;
+        setupEventProcessor( ep );
+
+        // Report we are started and ready to receive messages
+        sendReady( rpi0 );
+
+        // Default starting values, unless PicoState::initialize() restored
+        // what RPi0 configured before the last reset
+        // (at least for now while testing, RPi0 can change these via msg)
+        // TODO: Perhaps eventual make the default allMsgsSendOff()
+        if ( !PicoState::configRestored() )
+        {
+            PicoState::setConfig( PicoState::defaultConfig() );
+        }
+
+        MainProcess::runMainEventLoop( Events(), ep, smp, rpi0 );
+    }
+
+    [[noreturn]] void freezeUntilReset( SerialLinkPico& rpi0 )
+    {
+        // From this point, recovering from serious error we can't handle
+        // No matter what, this proceess ends in resetting Pico
+
+        output2cout( "Pico frozen and displaying fast LED strobe" );
+
+        // Just spin and put HeartBeatLed on fast strobe
+        constexpr int kWaitTimeInMin{ 1 };
+        for ( int i{ 0 }; i < kWaitTimeInMin * 60 * 10; ++i )
+        {
+            Clock::sleep( 100ms );
+            HeartBeatLed::toggle();
+
+            // See if we get a sent a reset message
+            if ( rpi0.isReadable() )
+            {
+                auto msgType = rpi0.getMsgType();
+                if ( msgType && *msgType == MsgId::kResetPicoMsg )
+                {
+                    PicoReset::reset( rpi0 );
+                }
+            }
+
+            // If no reset msg, we keep strobing the LED
+        }
+
+        // If we get here, just force reset
+        output2cout( "Fatal reset" );
+        PicoReset::fatalReset();
+    }
+
 }    // namespace
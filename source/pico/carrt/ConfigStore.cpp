@@ -0,0 +1,331 @@
+/*
+    ConfigStore.cpp - Keeps the RPi0-set configuration of CARRT-Pico in flash
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ConfigStore.h"
+
+#include <hardware/flash.h>
+#include <hardware/sync.h>
+#include <pico/multicore.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "CarrtError.h"
+#include "CarrtPicoDefines.h"
+#include "Clock.h"
+#include "ImpactDetector.h"
+#include "NavRate.h"
+#include "OutputUtils.hpp"
+#include "SerialLinkPico.h"
+#include "SerialMessages.h"
+
+// From the Pico SDK's linker script: the end of the program in flash
+extern "C"
+{
+    extern char __flash_binary_end;
+}
+
+namespace
+{
+    // What goes in each slot; a slot still all 1s (erased) is empty
+    struct Record
+    {
+        std::uint32_t mMagic;
+        std::uint32_t mSequence;
+        std::uint32_t mVersion;
+        std::uint32_t mSendMsgs;
+        std::uint32_t mAutoCalibrate;
+        std::uint32_t mNavRateHz;
+        std::uint32_t mImpactEnabled;
+        std::uint32_t mImpactAccelThreshold;
+        std::uint32_t mImpactStallMs;
+        std::uint32_t mCrc;    // Over everything above
+    };
+
+    constexpr std::uint32_t kMagic{ 0x4341'5254 };    // "CART"
+
+    // Bump whenever Record changes; slots from other versions are ignored
+    constexpr std::uint32_t kVersion{ 2 };
+
+    constexpr std::uint32_t kSlotSize{ FLASH_PAGE_SIZE };
+    constexpr int kNbrSlots{ FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE };
+
+    static_assert( sizeof( Record ) <= kSlotSize, "Config record must fit in a flash page" );
+    static_assert( CARRTPICO_CONFIG_FLASH_OFFSET % FLASH_SECTOR_SIZE == 0,
+                   "Config must start on a flash sector boundary" );
+
+    bool sUsable{ false };
+    PicoState::Config sSaved{};
+    std::uint32_t sSequence{ 0 };    // Of the newest slot
+    int sNextSlot{ kNbrSlots };      // kNbrSlots means the sector is full
+
+    // Waiting to hold steady before it gets saved
+    PicoState::Config sPending{};
+    std::uint32_t sPendingSince{ 0 };
+
+    // factoryReset() leaves the erase to saveIfChanged()
+    bool sErasePending{ false };
+
+    std::uint32_t crc32( const void* data, std::size_t len ) noexcept
+    {
+        const std::uint8_t* bytes{ static_cast<const std::uint8_t*>( data ) };
+        std::uint32_t crc{ 0xFFFF'FFFF };
+        for ( std::size_t i = 0; i < len; ++i )
+        {
+            crc ^= bytes[ i ];
+            for ( int bit = 0; bit < 8; ++bit )
+            {
+                crc = ( crc >> 1 ) ^ ( 0xEDB8'8320 & ( 0 - ( crc & 1 ) ) );
+            }
+        }
+        return ~crc;
+    }
+
+    std::uint32_t crcOf( const Record& r ) noexcept
+    {
+        return crc32( &r, offsetof( Record, mCrc ) );
+    }
+
+    Record readSlot( int slot ) noexcept
+    {
+        // Flash is memory mapped, so reading needs nothing special
+        Record r;
+        std::memcpy( &r,
+                     reinterpret_cast<const void*>( XIP_BASE + CARRTPICO_CONFIG_FLASH_OFFSET
+                                                    + slot * kSlotSize ),
+                     sizeof( r ) );
+        return r;
+    }
+
+    bool isValid( const Record& r ) noexcept
+    {
+        return r.mMagic == kMagic && r.mVersion == kVersion && r.mCrc == crcOf( r );
+    }
+
+    PicoState::Config toConfig( const Record& r ) noexcept
+    {
+        return { .mSendMsgs = r.mSendMsgs,
+                 .mAutoCalibrate = r.mAutoCalibrate != 0,
+                 .mNavRateHz = static_cast<std::uint16_t>( r.mNavRateHz ),
+                 .mImpactEnabled = r.mImpactEnabled != 0,
+                 .mImpactAccelThreshold = static_cast<std::uint16_t>( r.mImpactAccelThreshold ),
+                 .mImpactStallMs = static_cast<std::uint16_t>( r.mImpactStallMs ) };
+    }
+
+    bool isErased( const Record& r ) noexcept
+    {
+        Record erased;
+        std::memset( &erased, 0xFF, sizeof( erased ) );
+        return std::memcmp( &r, &erased, sizeof( r ) ) == 0;
+    }
+
+    // Nothing may run from flash while it is erased or programmed, so park
+    // Core1 (it runs multicore_lockout_victim_init()) and keep Core0's
+    // interrupts off until done
+    template<typename F>
+    void withFlashLocked( F&& f ) noexcept
+    {
+        multicore_lockout_start_blocking();
+        std::uint32_t interrupts{ save_and_disable_interrupts() };
+
+        f();
+
+        restore_interrupts( interrupts );
+        multicore_lockout_end_blocking();
+    }
+
+    void eraseSector() noexcept
+    {
+        withFlashLocked(
+            [] { flash_range_erase( CARRTPICO_CONFIG_FLASH_OFFSET, FLASH_SECTOR_SIZE ); } );
+        sNextSlot = 0;
+    }
+
+    // Returns false if what got written doesn't read back
+    bool save( const PicoState::Config& config ) noexcept
+    {
+        if ( sNextSlot >= kNbrSlots )
+        {
+            eraseSector();
+        }
+
+        Record r{ .mMagic = kMagic,
+                  .mSequence = sSequence + 1,
+                  .mVersion = kVersion,
+                  .mSendMsgs = config.mSendMsgs,
+                  .mAutoCalibrate = config.mAutoCalibrate,
+                  .mNavRateHz = config.mNavRateHz,
+                  .mImpactEnabled = config.mImpactEnabled,
+                  .mImpactAccelThreshold = config.mImpactAccelThreshold,
+                  .mImpactStallMs = config.mImpactStallMs,
+                  .mCrc = 0 };
+        r.mCrc = crcOf( r );
+
+        // Flash is programmed a page at a time; the rest stays erased
+        std::uint8_t page[ kSlotSize ];
+        std::memset( page, 0xFF, sizeof( page ) );
+        std::memcpy( page, &r, sizeof( r ) );
+
+        int slot{ sNextSlot++ };
+        withFlashLocked( [&] {
+            flash_range_program( CARRTPICO_CONFIG_FLASH_OFFSET + slot * kSlotSize, page, kSlotSize );
+        } );
+
+        sSaved = config;
+        if ( !isValid( readSlot( slot ) ) )
+        {
+            return false;
+        }
+        sSequence = r.mSequence;
+        return true;
+    }
+
+    // Stalling both cores only loses msgs or encoder edges if CARRT is
+    // moving or the RPi0 is talking
+    bool safeToStall( SerialLinkPico& link )
+    {
+        return !ImpactDetector::isDriving() && !link.isReadable()
+               && link.millisSinceLastMsg() >= CARRTPICO_CONFIG_SAVE_QUIET_MS;
+    }
+
+    void reportNotSaved( SerialLink& link, int functionId, int errorId )
+    {
+        output2cout( "Pico config could not be saved to flash" );
+
+        int errCode{ makePicoErrorId( kPicoConfigStoreError, functionId, errorId ) };
+        ErrorReportMsg errRpt( kPicoNonFatalError, errCode, Clock::millis() );
+        errRpt.sendOut( link );
+    }
+
+}    // namespace
+
+bool ConfigStore::load( PicoState::Config* config ) noexcept
+{
+    sSaved = PicoState::defaultConfig();
+    sPending = sSaved;
+    sSequence = 0;
+    sNextSlot = kNbrSlots;
+
+    // Never touch flash the program itself lives in
+    auto binaryEnd{ reinterpret_cast<std::uintptr_t>( &__flash_binary_end ) };
+    sUsable = binaryEnd <= XIP_BASE + CARRTPICO_CONFIG_FLASH_OFFSET;
+    if ( !sUsable )
+    {
+        return false;
+    }
+
+    bool found{ false };
+    for ( int slot = 0; slot < kNbrSlots; ++slot )
+    {
+        Record r{ readSlot( slot ) };
+        if ( isErased( r ) )
+        {
+            if ( sNextSlot == kNbrSlots )
+            {
+                sNextSlot = slot;
+            }
+        }
+        else if ( isValid( r ) && ( !found || r.mSequence > sSequence ) )
+        {
+            found = true;
+            sSequence = r.mSequence;
+            sSaved = toConfig( r );
+        }
+    }
+
+    sPending = sSaved;
+    if ( found )
+    {
+        *config = sSaved;
+    }
+    return found;
+}
+
+void ConfigStore::saveIfChanged( SerialLinkPico& link )
+{
+    PicoState::Config current{ PicoState::getConfig() };
+    std::uint32_t now{ Clock::millis() };
+
+    if ( current != sPending )
+    {
+        // Still changing (the RPi0 usually sends several config msgs in a row)
+        sPending = current;
+        sPendingSince = now;
+        return;
+    }
+
+    bool wantSave{ current != sSaved && now - sPendingSince >= CARRTPICO_CONFIG_SAVE_DELAY_MS };
+    if ( ( !wantSave && !sErasePending ) || !safeToStall( link ) )
+    {
+        // Nothing to do, or hold off and try again next time through
+        return;
+    }
+
+    if ( sErasePending )
+    {
+        output2cout( "Pico erasing saved config from flash" );
+        eraseSector();
+        sSequence = 0;
+        sErasePending = false;
+    }
+
+    if ( !wantSave )
+    {
+        return;
+    }
+
+    if ( !sUsable )
+    {
+        // Program overlaps CARRTPICO_CONFIG_FLASH_OFFSET
+        sSaved = current;
+        reportNotSaved( link, 1, 1 );
+    }
+    else
+    {
+        output2cout( sNextSlot >= kNbrSlots ? "Pico saving config to flash (erasing sector)"
+                                            : "Pico saving config to flash" );
+        if ( !save( current ) )
+        {
+            reportNotSaved( link, 1, 2 );
+        }
+        else
+        {
+            output2cout( "Pico config saved to flash" );
+        }
+    }
+}
+
+void ConfigStore::factoryReset()
+{
+    // Erasing stalls both cores (see ConfigStore.h), so that waits for
+    // saveIfChanged(); the defaults take effect right away
+    sErasePending = sUsable;
+
+    sSaved = PicoState::defaultConfig();
+    sPending = sSaved;
+    PicoState::setConfig( sSaved );
+
+    // PicoState only holds these two; put them into effect too
+    NavRate::setRate( sSaved.mNavRateHz );
+    ImpactDetector::configure( sSaved.mImpactEnabled, sSaved.mImpactAccelThreshold,
+                               sSaved.mImpactStallMs );
+
+    output2cout( "Pico config reset to defaults" );
+}
@@ -0,0 +1,61 @@
+/*
+    ConfigStore.h - Keeps the RPi0-set configuration of CARRT-Pico in flash
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ConfigStore_h
+#define ConfigStore_h
+
+#include "PicoState.h"
+
+class SerialLinkPico;
+
+// The PicoState::Config (msgs to send, auto-calibration, nav update rate,
+// impact detection settings) lives in one flash sector (at offset
+// CARRTPICO_CONFIG_FLASH_OFFSET) split into page-sized slots.  Each save
+// goes in the next empty slot with a sequence number and a CRC, so the
+// sector is only erased once every slot has been used; on start up the
+// newest slot with a good CRC wins.  All of these are called from Core0.
+//
+// Writing flash stalls both cores: Core1 is locked out and Core0 runs with
+// interrupts off for ~1 ms per slot programmed and ~45 ms (up to ~400 ms
+// worst case) when the sector has to be erased.  Meanwhile only what fits
+// in the UART's 32 byte RX FIFO survives from the RPi0, Core1's timers run
+// late, and the encoder PIO FIFOs (8 edges) overflow if the wheels turn.
+// So a save only happens once the config has held steady, CARRT is
+// stopped, and the RPi0 has sent nothing for CARRTPICO_CONFIG_SAVE_QUIET_MS;
+// each save is announced on stdout.  The RPi0 should not expect replies
+// for a while after changing the config while stopped.
+namespace ConfigStore
+{
+    // Returns false if nothing valid is saved (config is left untouched)
+    bool load( PicoState::Config* config ) noexcept;
+
+    // Call from the main loop once Core1 is running: saves PicoState's
+    // config once it differs from what's saved, has held steady for
+    // CARRTPICO_CONFIG_SAVE_DELAY_MS, and it is safe to stall (see above);
+    // also does the erase factoryReset() asks for, under the same rules
+    void saveIfChanged( SerialLinkPico& link );
+
+    // Puts PicoState back to its defaults right away; the saved config is
+    // erased by a later saveIfChanged(), once it is safe to stall (a reset
+    // before then still restores the old config)
+    void factoryReset();
+
+};    // namespace ConfigStore
+
+#endif    // ConfigStore_h
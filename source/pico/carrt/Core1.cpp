@@ -21,39 +21,98 @@
 
 #include <hardware/clocks.h>
 #include <hardware/i2c.h>
+#include <hardware/sync.h>
 #include <hardware/timer.h>
 #include <hardware/uart.h>
 #include <pico/multicore.h>
 #include <pico/stdlib.h>
-#include <pico/util/queue.h>
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
 #include <utility>
 
+#include "Batteries.h"
 #include "CarrtError.h"
 #include "CarrtPicoDefines.h"
 #include "Clock.h"
 #include "Encoders.h"
 #include "EventManager.h"
+#include "I2C.h"
+#include "NavSampler.h"
 #include "OutputUtils.hpp"
 #include "PicoState.h"
+#include "SpscQueue.hpp"
 
 namespace
 {
 
-    struct EventForCore1
+    // What Core0 asks Core1 to do
+    struct CommandForCore1
     {
-        int kind;
+        enum Kind : std::uint8_t
+        {
+            kDoEvent,
+            kScheduleEvent,
+            kCancelEvent,
+            kStartNavSampling,
+            kStopNavSampling
+        };
+
+        Kind kind;
+        std::uint8_t pri;
+        int event;
         int param;
+        Core1::ScheduledEventId handle;
+        std::uint32_t delayUs;
+        std::uint32_t periodUs;
     };
 
-    queue_t sCore0toCore1Events{};
+    // One slot per scheduled event.  Only used on Core1, but the alarm
+    // callback (an IRQ) frees one-shot slots behind the thread's back
+    struct ScheduledEvent
+    {
+        volatile Core1::ScheduledEventId handle;    // kNoScheduledEvent = free
+        alarm_id_t alarm;
+        int event;
+        int param;
+        std::uint32_t periodUs;
+        EventManager::EventPriority pri;
+    };
+
+    // Core0 is the only producer and Core1 the only consumer
+    SpscQueue<CommandForCore1, SIZE_OF_CORE0_TO_CORE1_QUEUE>
+        sCore0toCore1Commands{};
     alarm_pool_t* sCore1AlarmPool{ nullptr };
 
-    std::int64_t alarmCallback( alarm_id_t alarm, void* userData );
+    // Only used on Core0
+    Core1::ScheduledEventId sLastHandle{ Core1::kNoScheduledEvent };
+
+    // Only used on Core1
+    ScheduledEvent sScheduledEvents[ CORE1_MAX_SCHEDULED_EVENTS ]{};
+    repeating_timer_t sEncoderSampleTimer{};
+    repeating_timer_t sNavSampleTimer{};
+    bool sNavSampling{ false };
+
+    // Set by the nav sample timer; the read itself is submitted from
+    // Core1's main loop (and runs under the I2C interrupt)
+    volatile bool sNavSampleDue{ false };
+
+    void postCommandForCore1( const CommandForCore1& cmd );
+
+    std::int64_t scheduledEventCallback( alarm_id_t alarm, void* userData );
     bool timerCallback( repeating_timer_t* );
+    bool encoderSampleCallback( repeating_timer_t* );
+    bool navSampleCallback( repeating_timer_t* );
+    void startEncoders();
+    void startNavSampling();
+    void stopNavSampling();
     void core1Main();
+    void sampleNavIfDue();
     void checkForEventsFromCore0();
     void handleEventFromCore0();
+    void scheduleEvent( const CommandForCore1& cmd );
+    void cancelEvent( Core1::ScheduledEventId handle );
 
 }    // namespace
 
@@ -65,9 +124,6 @@ namespace
 
 void Core1::launchCore1()
 {
-    queue_init( &sCore0toCore1Events, sizeof( EventForCore1 ),
-                SIZE_OF_CORE0_TO_CORE1_QUEUE );
-
     multicore_launch_core1( core1Main );
 
     // Wait for it to start up
@@ -75,7 +131,7 @@ void Core1::launchCore1()
 
     if ( flag != CORE1_SUCCESS )
     {
-        throw CarrtError(
+        raiseCarrtError(
             makePicoErrorId( PicoError::kPicoMulticoreError, 1, 1 ),
             "CARRT Pico failed to start Core1" );
     }
@@ -83,17 +139,78 @@ void Core1::launchCore1()
 
 void Core1::queueEventForCore1( EvtId event, int waitMs )
 {
-    EventForCore1 evt{ .kind = std::to_underlying( event ), .param = waitMs };
-    if ( !queue_try_add( &sCore0toCore1Events, &evt ) )
+    if ( event == EvtId::kInitEncoders || event == EvtId::kInitBatteries
+         || event == EvtId::kInitI2C )
+    {
+        postCommandForCore1( { .kind = CommandForCore1::kDoEvent,
+                               .event = std::to_underlying( event ) } );
+    }
+    else
+    {
+        scheduleEvent( event, 0, static_cast<std::uint32_t>( waitMs ) * 1000 );
+    }
+}
+
+Core1::ScheduledEventId Core1::scheduleEvent( EvtId event, int param,
+                                              std::uint32_t delayUs,
+                                              std::uint32_t periodUs,
+                                              EventManager::EventPriority pri )
+{
+    // Handles only need to be unique among events scheduled at one time
+    sLastHandle = ( sLastHandle == std::numeric_limits<ScheduledEventId>::max() )
+                      ? kNoScheduledEvent + 1
+                      : sLastHandle + 1;
+
+    postCommandForCore1( { .kind = CommandForCore1::kScheduleEvent,
+                           .pri = static_cast<std::uint8_t>( pri ),
+                           .event = std::to_underlying( event ),
+                           .param = param,
+                           .handle = sLastHandle,
+                           .delayUs = delayUs,
+                           .periodUs = periodUs } );
+
+    return sLastHandle;
+}
+
+void Core1::startNavSampling()
+{
+    postCommandForCore1( { .kind = CommandForCore1::kStartNavSampling } );
+}
+
+void Core1::stopNavSampling()
+{
+    postCommandForCore1( { .kind = CommandForCore1::kStopNavSampling } );
+}
+
+void Core1::cancelScheduledEvent( ScheduledEventId id )
+{
+    if ( id != kNoScheduledEvent )
     {
-        // These get added very rarely, so impossible to have a full queue
-        // unless something else is very wrong
-        throw CarrtError(
-            makePicoErrorId( PicoError::kPicoMulticoreError, 1, 2 ),
-            "CARRT Pico failed to post to Core1 queue" );
+        postCommandForCore1(
+            { .kind = CommandForCore1::kCancelEvent, .handle = id } );
     }
 }
 
+namespace
+{
+
+    void postCommandForCore1( const CommandForCore1& cmd )
+    {
+        if ( !sCore0toCore1Commands.tryPush( cmd ) )
+        {
+            // These get added very rarely, so impossible to have a full
+            // queue unless something else is very wrong
+            raiseCarrtError(
+                makePicoErrorId( PicoError::kPicoMulticoreError, 1, 2 ),
+                "CARRT Pico failed to post to Core1 queue" );
+        }
+
+        // Wake Core1 from its __wfe()
+        __sev();
+    }
+
+}    // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 
 // Code above here runs on Core0
@@ -118,7 +235,11 @@ namespace
     {
         repeating_timer_t timer{};
 
-        sCore1AlarmPool = alarm_pool_create( TIMER_IRQ_2, 4 );
+        // Lets Core0 park us while it writes flash (see ConfigStore)
+        multicore_lockout_victim_init();
+
+        sCore1AlarmPool
+            = alarm_pool_create( TIMER_IRQ_2, CORE1_MAX_SCHEDULED_EVENTS + 3 );
         if ( sCore1AlarmPool
              && alarm_pool_add_repeating_timer_ms(
                  sCore1AlarmPool, -125, timerCallback, nullptr, &timer ) )
@@ -138,17 +259,35 @@ namespace
 
         while ( 1 )
         {
+            sampleNavIfDue();
+            NavSampler::pollSample();
             checkForEventsFromCore0();
         }
     }
 
+    void sampleNavIfDue()
+    {
+        if ( sNavSampleDue )
+        {
+            sNavSampleDue = false;
+            NavSampler::startSample();
+        }
+    }
+
     void checkForEventsFromCore0()
     {
-        if ( queue_is_empty( &sCore0toCore1Events ) )
+        if ( sCore0toCore1Commands.isEmpty() )
         {
             // Let Core1 sleep, Core1 is just processing timer/alarm
-            // callbacks, gpio encoder interrupts, and msgs from Core0...
-            Clock::sleep( 10ms );
+            // callbacks and msgs from Core0...
+            // Any of those ends the __wfe(): interrupts on this core
+            // directly, Core0 via the __sev() in postCommandForCore1().
+            // (The nav sample timer and the end of a nav sample read do a
+            // __sev() too, in case they land between the loop's nav
+            // sampling calls and here.)
+            // A __sev() that lands after the isEmpty() check leaves the
+            // event register set, so __wfe() then returns immediately.
+            __wfe();
         }
         else
         {
@@ -158,40 +297,46 @@ namespace
 
     void handleEventFromCore0()
     {
-        EventForCore1 evt{ 0, 0 };
-        queue_remove_blocking( &sCore0toCore1Events, &evt );
-        EvtId evtId = static_cast<EvtId>( evt.kind );
-        switch ( evtId )
+        CommandForCore1 cmd{};
+        if ( !sCore0toCore1Commands.tryPop( &cmd ) )
+        {
+            return;
+        }
+
+        switch ( cmd.kind )
         {
-            case EvtId::kBNO055InitializeEvent:
-                alarm_pool_add_alarm_in_ms(
-                    sCore1AlarmPool, static_cast<std::uint32_t>( evt.param ),
-                    alarmCallback,
-                    reinterpret_cast<void*>(
-                        std::to_underlying( EvtId::kBNO055InitializeEvent ) ),
-                    true );
+            case CommandForCore1::kDoEvent:
+                if ( static_cast<EvtId>( cmd.event ) == EvtId::kInitEncoders )
+                {
+                    startEncoders();
+                }
+                else if ( static_cast<EvtId>( cmd.event ) == EvtId::kInitBatteries )
+                {
+                    // So the ADC's DMA interrupt is handled on Core1
+                    Batteries::initBatteries();
+                }
+                else if ( static_cast<EvtId>( cmd.event ) == EvtId::kInitI2C )
+                {
+                    // So transfers (NavSampler's) are submitted and
+                    // finished on Core1
+                    I2C::initI2C();
+                }
                 break;
 
-            case EvtId::kBNO055BeginCalibrationEvent:
-                alarm_pool_add_alarm_in_ms(
-                    sCore1AlarmPool, static_cast<std::uint32_t>( evt.param ),
-                    alarmCallback,
-                    reinterpret_cast<void*>( std::to_underlying(
-                        EvtId::kBNO055BeginCalibrationEvent ) ),
-                    true );
+            case CommandForCore1::kStartNavSampling:
+                startNavSampling();
                 break;
 
-            case EvtId::kBNO055ResetEvent:
-                alarm_pool_add_alarm_in_ms(
-                    sCore1AlarmPool, static_cast<std::uint32_t>( evt.param ),
-                    alarmCallback,
-                    reinterpret_cast<void*>(
-                        std::to_underlying( EvtId::kBNO055ResetEvent ) ),
-                    true );
+            case CommandForCore1::kStopNavSampling:
+                stopNavSampling();
                 break;
 
-            case EvtId::kInitEncoders:
-                Encoders::initEncoders();
+            case CommandForCore1::kScheduleEvent:
+                scheduleEvent( cmd );
+                break;
+
+            case CommandForCore1::kCancelEvent:
+                cancelEvent( cmd.handle );
                 break;
 
             default:
@@ -199,16 +344,128 @@ namespace
         }
     }
 
+    void startEncoders()
+    {
+        Encoders::initEncoders();
+
+        // The PIO counts the edges; we just collect them
+        if ( !alarm_pool_add_repeating_timer_us(
+                 sCore1AlarmPool, -CARRTPICO_ENCODER_SAMPLE_US,
+                 encoderSampleCallback, nullptr, &sEncoderSampleTimer ) )
+        {
+            // Core0 reports it to the RPi0
+            Events().queueEvent( EvtId::kErrorEvent,
+                                 std::to_underlying( EvtId::kInitEncoders ), 0,
+                                 EventManager::kUrgentPriority );
+        }
+    }
+
+    void startNavSampling()
+    {
+        if ( sNavSampling )
+        {
+            return;
+        }
+
+        // First sample right away rather than a period from now
+        NavSampler::startSample();
+
+        sNavSampling = alarm_pool_add_repeating_timer_us(
+            sCore1AlarmPool, -CARRTPICO_NAV_SAMPLE_US, navSampleCallback,
+            nullptr, &sNavSampleTimer );
+        if ( !sNavSampling )
+        {
+            // Core0 reports it to the RPi0 (nav updates are what go without)
+            Events().queueEvent( EvtId::kErrorEvent,
+                                 std::to_underlying( EvtId::kNavUpdateEvent ), 0,
+                                 EventManager::kUrgentPriority );
+        }
+    }
+
+    void stopNavSampling()
+    {
+        if ( sNavSampling )
+        {
+            cancel_repeating_timer( &sNavSampleTimer );
+            sNavSampling = false;
+        }
+        sNavSampleDue = false;
+    }
+
+    void scheduleEvent( const CommandForCore1& cmd )
+    {
+        auto slot{ std::ranges::find( sScheduledEvents,
+                                      Core1::kNoScheduledEvent,
+                                      &ScheduledEvent::handle ) };
+        if ( slot == std::end( sScheduledEvents ) )
+        {
+            // Core0 reports it to the RPi0
+            Events().queueEvent( EvtId::kErrorEvent, cmd.event, 0,
+                                 EventManager::kUrgentPriority );
+            return;
+        }
+
+        slot->event = cmd.event;
+        slot->param = cmd.param;
+        slot->periodUs = cmd.periodUs;
+        slot->pri = static_cast<EventManager::EventPriority>( cmd.pri );
+        slot->handle = cmd.handle;
+
+        // An alarm that is already due fires inside this call; a one-shot
+        // has then freed its slot by the time we get the (0) id back
+        alarm_id_t alarm{ alarm_pool_add_alarm_in_us(
+            sCore1AlarmPool, cmd.delayUs, scheduledEventCallback, slot,
+            true ) };
+        if ( alarm < 0 )
+        {
+            slot->handle = Core1::kNoScheduledEvent;
+            Events().queueEvent( EvtId::kErrorEvent, cmd.event, 0,
+                                 EventManager::kUrgentPriority );
+        }
+        else
+        {
+            slot->alarm = alarm;
+        }
+    }
+
+    void cancelEvent( Core1::ScheduledEventId handle )
+    {
+        // Keep the alarm callback from freeing the slot (and the SDK from
+        // reusing its alarm id) between finding the slot and cancelling
+        std::uint32_t irqStatus{ save_and_disable_interrupts() };
+
+        auto slot{ std::ranges::find( sScheduledEvents, handle,
+                                      &ScheduledEvent::handle ) };
+        if ( slot != std::end( sScheduledEvents ) )
+        {
+            alarm_pool_cancel_alarm( sCore1AlarmPool, slot->alarm );
+            slot->handle = Core1::kNoScheduledEvent;
+        }
+
+        restore_interrupts( irqStatus );
+    }
+
 ////////////////////////////////////////////////////////////////////////////
 
 //      Alarm and Timer callbacks (all running on Core1)
 
 ////////////////////////////////////////////////////////////////////////////
 
-    std::int64_t alarmCallback( alarm_id_t, void* userData )
+    std::int64_t scheduledEventCallback( alarm_id_t, void* userData )
     {
-        int eventType{ reinterpret_cast<int>( userData ) };
-        Events().queueEvent( static_cast<EvtId>( eventType ) );
+        auto slot{ static_cast<ScheduledEvent*>( userData ) };
+
+        Events().queueEvent( static_cast<EvtId>( slot->event ), slot->param,
+                             Clock::millis(), slot->pri );
+
+        if ( slot->periodUs > 0 )
+        {
+            // Negative reschedules relative to when this alarm was due
+            // (not to now), so periodic events don't drift
+            return -static_cast<std::int64_t>( slot->periodUs );
+        }
+
+        slot->handle = Core1::kNoScheduledEvent;
         return 0;
     }
 
@@ -221,13 +478,14 @@ namespace
         ++eighthSecCount;
         eighthSecCount %= 64;
 
-        // Queue nav update events every 1/8 second
-        // Event parameter counts eighth seconds ( 0, 1, 2, 3, 4, 5, 6, 7 )
-        Events().queueEvent( EvtId::kNavUpdateEvent, eighthSecCount % 8,
-                             timeTick, EventManager::kHighPriority );
+        // Nav update events have their own (adjustable) periodic
+        // schedule; see NavRate
+
+        // Timer events only send msgs, so skip any the RPi0 doesn't want
+        // (the handlers check again, in case that changes in between)
 
         // Quarter second events
-        if ( ( eighthSecCount % 2 ) == 0 )
+        if ( ( eighthSecCount % 2 ) == 0 && PicoState::wantQtrSecTimerMsgs() )
         {
             // Event parameter counts quarter seconds ( 0, 1, 2, 3 )
             Events().queueEvent( EvtId::kQuarterSecondTimerEvent,
@@ -237,9 +495,12 @@ namespace
         // 1 second events
         if ( ( eighthSecCount % 8 ) == 0 )
         {
-            // Event parameter counts seconds to 8 ( 0, 1, 2, 3, 4, 5, 6, 7 )
-            Events().queueEvent( EvtId::kOneSecondTimerEvent,
-                                 ( eighthSecCount / 8 ), timeTick );
+            if ( PicoState::want1SecTimerMsgs() )
+            {
+                // Event parameter counts seconds to 8 ( 0, 1, 2, ..., 7 )
+                Events().queueEvent( EvtId::kOneSecondTimerEvent,
+                                     ( eighthSecCount / 8 ), timeTick );
+            }
             Events().queueEvent( EvtId::kPulsePicoLedEvent );
 
             if ( PicoState::calibrationInProgress() )
@@ -251,7 +512,11 @@ namespace
         // 8 second events
         if ( eighthSecCount == 0 )
         {
-            Events().queueEvent( EvtId::kEightSecondTimerEvent, 0, timeTick );
+            // The 8 second handler also sends the battery msgs
+            if ( PicoState::want8SecTimerMsgs() || PicoState::wantBatteryMsgs() )
+            {
+                Events().queueEvent( EvtId::kEightSecondTimerEvent, 0, timeTick );
+            }
             if ( !PicoState::calibrationInProgress() )
             {
                 // If calibrationInProgess, already sent one from 1-second
@@ -263,4 +528,17 @@ namespace
         return true;
     }
 
+    bool encoderSampleCallback( repeating_timer_t* )
+    {
+        Encoders::sampleCounts();
+        return true;
+    }
+
+    bool navSampleCallback( repeating_timer_t* )
+    {
+        sNavSampleDue = true;
+        __sev();
+        return true;
+    }
+
 }    // namespace
@@ -23,15 +23,42 @@
 
 #include <cstdint>
 
-enum class EvtId;
+#include "EventManager.h"
 
 namespace Core1
 {
 
+    // Handle for an event scheduled on Core1 (never kNoScheduledEvent)
+    using ScheduledEventId = int;
+
+    constexpr ScheduledEventId kNoScheduledEvent{ 0 };
+
     void launchCore1();
 
+    // Either Core1 acts on the event itself (kInitEncoders, kInitBatteries,
+    // kInitI2C) or, for any other event, Core1 queues it back to Core0
+    // after waitMs
     void queueEventForCore1( EvtId event, int waitMs = 0 );
 
+    // Have Core1 queue event (for Core0) after delayUs and then, if
+    // periodUs > 0, every periodUs after that.  Periods are measured
+    // from the previous scheduled time, so they don't drift.
+    // Call only from Core0.
+    ScheduledEventId scheduleEvent( EvtId event, int param, std::uint32_t delayUs,
+                                    std::uint32_t periodUs = 0,
+                                    EventManager::EventPriority pri
+                                    = EventManager::kLowPriority );
+
+    // Core1 reads the BNO055 every CARRTPICO_NAV_SAMPLE_US for NavSampler
+    // in between these (only while the BNO055 is in NDOF mode).
+    // Call only from Core0.
+    void startNavSampling();
+    void stopNavSampling();
+
+    // Harmless if the event already fired (one-shot) or was cancelled
+    // Call only from Core0.
+    void cancelScheduledEvent( ScheduledEventId id );
+
     bool isRunningCore1();
 
 }    // namespace Core1
@@ -34,20 +34,26 @@ enum class EvtId : int
     kNavUpdateEvent,
 
     // BNO055 events
+    kInitI2C,
     kBNO055InitializeEvent,
+    kBNO055InitFinishedEvent,
     kBNO055ResetEvent,
     kBNO055BeginCalibrationEvent,
     kSendCalibrationInfoEvent,
+    kBNO055ProfileReadEvent,
+    kBNO055ProfileDoneEvent,
 
     // Encoder events
     kInitEncoders,
-    kEncoderLeftEvent,
-    kEncoderRightEvent,
+
+    // Impact detection events
+    kImpactCheckEvent,
 
     // Pulse LEDs events
     kPulsePicoLedEvent,
 
     // Battery events
+    kInitBatteries,
     kBatteryLowEvent,
 
     // Reset
@@ -25,13 +25,55 @@
 #include "CarrtPicoReset.h"
 #include "Clock.h"
 #include "Core1.h"
+#include "Encoders.h"
 #include "EventManager.h"
 #include "HeartBeatLed.h"
+#include "ImpactDetector.h"
+#include "NavSampler.h"
+#include "Odometry.h"
 #include "OutputUtils.hpp"
 #include "PicoState.h"
+#include "PoseEstimator.h"
 #include "SerialLink.h"
 #include "SerialMessages.h"
 
+namespace
+{
+    // BNO055 bring-up is a chain of delayed events (reset -> initialize ->
+    // init finished), as is reading the calibration profile (CONFIG mode ->
+    // profile read -> back in NDOF).  Each carries the sequence number of
+    // the reset that started it, so a chain overtaken by a newer reset dies
+    // out quietly
+    int sBno055Sequence{ 0 };
+
+    // Sequence number of the profile read under way (if any)
+    int sProfileReadSequence{ -1 };
+
+    // The NavSampler sample the impact check last looked at
+    std::uint32_t sLastImpactSample{ 0 };
+
+    void sendPoseUpdate( SerialLink& link, const PoseEstimator::Pose& pose,
+                         std::uint32_t time )
+    {
+        if ( PicoState::wantPoseMsgs() )
+        {
+            PoseUpdateMsg poseUpdate( pose.x, pose.y, pose.heading, time );
+            poseUpdate.sendOut( link );
+        }
+    }
+
+    void sayStop( SerialLink& link, const char* why )
+    {
+        // Impact events are high priority and the link writes straight to
+        // the UART, so nothing else the Pico has to say gets ahead of this
+        PicoSaysStopMsg stop;
+        stop.sendOut( link );
+        ImpactDetector::tripped();
+
+        output2cout( "Pico says stop:", why );
+    }
+}    // namespace
+
 void NullEventHandler::handleEvent( EventManager& events, SerialLink& link,
                                     EvtId eventCode, int eventParam,
                                     std::uint32_t eventTime ) const
@@ -80,16 +122,17 @@ void EightSecondTimerHandler::handleEvent( EventManager& events,
 
     if ( PicoState::wantBatteryMsgs() )
     {
-        float icVolts = Batteries::getIcBatteryVoltage();
-        BatteryLevelUpdateMsg icMsg( Battery::kIcBattery, icVolts );
+        // Raw ADC counts; the RPi0 converts to volts
+        std::uint16_t icRaw = Batteries::getIcBatteryRaw();
+        BatteryLevelUpdateMsg icMsg( Battery::kIcBattery, icRaw );
         icMsg.sendOut( link );
 
-        float motorVolts = Batteries::getMotorBatteryVoltage();
-        BatteryLevelUpdateMsg motorMsg( Battery::kMotorBattery, motorVolts );
+        std::uint16_t motorRaw = Batteries::getMotorBatteryRaw();
+        BatteryLevelUpdateMsg motorMsg( Battery::kMotorBattery, motorRaw );
         motorMsg.sendOut( link );
 
-        // debug2cout( "IC V:", icVolts );
-        // debug2cout( "Motor V", motorVolts );
+        // debug2cout( "IC raw:", icRaw );
+        // debug2cout( "Motor raw", motorRaw );
     }
 }
 
@@ -99,13 +142,48 @@ void NavUpdateHandler::handleEvent( EventManager& events, SerialLink& link,
                                     EvtId eventCode, int eventParam,
                                     std::uint32_t eventTime ) const
 {
-    if ( PicoState::navCalibrated() && PicoState::wantNavMsgs() )
+    // Encoder edges are accumulated on Core1 and collected once per nav
+    // update (always collect and update odometry and pose so they stay
+    // current when msgs are off)
+    auto wheels{ Odometry::update( Encoders::takeCounts(), Clock::micros() ) };
+    PoseEstimator::addTravel( wheels );
+    if ( PicoState::wantEncoderMsgs() )
+    {
+        EncoderUpdateMsg encoderUpdate( wheels.leftSpeed, wheels.rightSpeed,
+                                        wheels.leftDistance, wheels.rightDistance,
+                                        eventTime );
+        encoderUpdate.sendOut( link );
+    }
+
+    // Core1 keeps the latest BNO055 reading on hand, so this costs no I2C
+    NavSampler::Sample nav;
+    if ( !PicoState::navCalibrated() || !NavSampler::latest( &nav ) )
     {
-        float heading = BNO055::getHeading();
-        NavUpdateMsg navUpdate( heading, eventTime );
+        // No heading to be had, so carry on along the last one
+        sendPoseUpdate( link, PoseEstimator::update(), eventTime );
+        return;
+    }
+
+    const auto& fusion{ nav.fusion };
+
+    if ( PicoState::wantNavMsgs() )
+    {
+        // Raw 1/16 degree units; the RPi0 converts (no FPU on the Pico)
+        NavUpdateMsg navUpdate( fusion.heading, eventTime );
         navUpdate.sendOut( link );
-        output2cout( "Sent Hdg: ", heading );
     }
+
+    if ( PicoState::wantExtendedNavMsgs() )
+    {
+        ExtendedNavUpdateMsg extNavUpdate(
+            { fusion.heading, fusion.roll, fusion.pitch },
+            { fusion.gyroX, fusion.gyroY, fusion.gyroZ },
+            { fusion.linAccelX, fusion.linAccelY, fusion.linAccelZ },
+            BNO055::packCalibration( fusion.calibration ), eventTime );
+        extNavUpdate.sendOut( link );
+    }
+
+    sendPoseUpdate( link, PoseEstimator::update( fusion.heading ), eventTime );
 }
 
 void InitializeBNO055Handler::handleEvent( EventManager& events,
@@ -113,13 +191,34 @@ void InitializeBNO055Handler::handleEvent( EventManager& events,
                                            int eventParam,
                                            std::uint32_t eventTime ) const
 {
+    if ( eventParam != sBno055Sequence )
+    {
+        return;
+    }
+
     output2cout( "Got BNO055 initialize event" );
 
-    // Note this call includes internal delay of ~600ms
-    BNO055::init();
+    // Finish once the BNO055 has switched to NDOF (rather than wait here)
+    BNO055::startInit();
+    Core1::scheduleEvent( EvtId::kBNO055InitFinishedEvent, sBno055Sequence,
+                          BNO055::kWaitAfterModeChange * 1000 );
+}
+
+void BNO055InitFinishedHandler::handleEvent( EventManager& events,
+                                             SerialLink& link, EvtId eventCode,
+                                             int eventParam,
+                                             std::uint32_t eventTime ) const
+{
+    if ( eventParam != sBno055Sequence )
+    {
+        return;
+    }
+
+    output2cout( "BNO055 initialized" );
+
+    // In NDOF now, so there is fusion data for Core1 to collect
+    Core1::startNavSampling();
 
-    // Because delay built into BNO055init() at driver level,
-    // we can trigger BeginCalibration without delay
     events.queueEvent( EvtId::kBNO055BeginCalibrationEvent );
 
     // And we are done with start up (also done after BNO055 reset)
@@ -133,10 +232,12 @@ void BNO055ResetHandler::handleEvent( EventManager& events, SerialLink& link,
 {
     output2cout( "Got BNO055 reset event" );
     // Note this call is followed by 650ms wait before we can call init()
+    Core1::stopNavSampling();
     BNO055::reset();
     PicoState::navCalibrated( false );
-    Core1::queueEventForCore1( EvtId::kBNO055InitializeEvent,
-                               BNO055::kWaitAfterPowerOnReset );
+    ++sBno055Sequence;
+    Core1::scheduleEvent( EvtId::kBNO055InitializeEvent, sBno055Sequence,
+                          BNO055::kWaitAfterPowerOnReset * 1000 );
 
     // While BNO055 resetting, we revert to "startup mode"
     PicoState::startUpFinished( false );
@@ -157,7 +258,15 @@ void SendCalibrationInfoHandler::handleEvent( EventManager& events,
                                               int eventParam,
                                               std::uint32_t eventTime ) const
 {
-    auto calibData{ BNO055::getCalibration() };
+    // The timer asks regardless, but there are no BNO055 readings mid
+    // bring-up (calibration status comes with each of Core1's samples)
+    NavSampler::Sample nav;
+    if ( !PicoState::startUpFinished() || !NavSampler::latest( &nav ) )
+    {
+        return;
+    }
+
+    auto calibData{ nav.fusion.calibration };
     bool status = BNO055::calibrationGood( calibData );
 
     // Set Pico state accordingly
@@ -177,6 +286,21 @@ void SendCalibrationInfoHandler::handleEvent( EventManager& events,
         if ( status )
         {
             output2cout( "Changed from not calibrated to CALIBRATED" );
+
+            // First time only (reading it briefly stops fusion): keep the
+            // profile for later BNO055 inits, and hand it to the RPi0 to
+            // give back after the next power on.  The read finishes once
+            // the BNO055 is in CONFIG mode (rather than wait here)
+            if ( !BNO055::haveSavedCalibrationProfile()
+                 && sProfileReadSequence != sBno055Sequence )
+            {
+                sProfileReadSequence = sBno055Sequence;
+                Core1::stopNavSampling();
+                BNO055::startCalibrationProfileRead();
+                Core1::scheduleEvent( EvtId::kBNO055ProfileReadEvent,
+                                      sBno055Sequence,
+                                      BNO055::kWaitToConfigMode * 1000 );
+            }
         }
         else
         {
@@ -202,35 +326,75 @@ void SendCalibrationInfoHandler::handleEvent( EventManager& events,
     //        calibData.system ) );
 }
 
-// ********************** Encoder event handlers
-
-void EncoderLeftEventHandler::handleEvent( EventManager& events,
-                                           SerialLink& link, EvtId eventCode,
-                                           int eventParam,
-                                           std::uint32_t eventTime ) const
+void BNO055ProfileReadHandler::handleEvent( EventManager& events,
+                                            SerialLink& link, EvtId eventCode,
+                                            int eventParam,
+                                            std::uint32_t eventTime ) const
 {
-    if ( PicoState::wantEncoderMsgs() )
+    if ( eventParam != sBno055Sequence )
     {
-        EncoderUpdateMsg encoderUpdateMsg( EncoderUpdateMsg::Side::kLeft, eventParam,
-                                eventTime );
-        encoderUpdateMsg.sendOut( link );
+        return;
     }
+
+    auto profile{ BNO055::finishCalibrationProfileRead() };
+    BNO055::saveCalibrationProfile( profile );
+    CalibrationProfileMsg profileMsg( profile );
+    profileMsg.sendOut( link );
+
+    // Back to NDOF, but no fusion data until the switch is done
+    Core1::scheduleEvent( EvtId::kBNO055ProfileDoneEvent, sBno055Sequence,
+                          BNO055::kWaitFromConfigMode * 1000 );
 }
 
-void EncoderRightEventHandler::handleEvent( EventManager& events,
-                                           SerialLink& link, EvtId eventCode,
-                                           int eventParam,
-                                           std::uint32_t eventTime ) const
+void BNO055ProfileDoneHandler::handleEvent( EventManager& events,
+                                            SerialLink& link, EvtId eventCode,
+                                            int eventParam,
+                                            std::uint32_t eventTime ) const
 {
-    if ( PicoState::wantEncoderMsgs() )
+    if ( eventParam != sBno055Sequence )
     {
-        EncoderUpdateMsg encoderUpdateMsg( EncoderUpdateMsg::Side::kRight, eventParam,
-                                eventTime );
-        encoderUpdateMsg.sendOut( link );
+        return;
     }
+
+    sProfileReadSequence = -1;
+    Core1::startNavSampling();
 }
 
+// ********************** Impact detection event handlers
+
+void ImpactCheckHandler::handleEvent( EventManager& events, SerialLink& link,
+                                      EvtId eventCode, int eventParam,
+                                      std::uint32_t eventTime ) const
+{
+    // Could be a check queued just before CARRT stopped
+    if ( !ImpactDetector::isWatching() )
+    {
+        return;
+    }
+
+    if ( ImpactDetector::wheelsStalled( Encoders::peekCounts(), Clock::micros() ) )
+    {
+        sayStop( link, "wheel stalled" );
+        return;
+    }
 
+    // Linear accel only means something once the BNO055 is running fusion;
+    // look at each of Core1's samples once (this check and the sampling
+    // run at the same rate, but aren't in step)
+    NavSampler::Sample nav;
+    if ( PicoState::startUpFinished() && NavSampler::latest( &nav )
+         && nav.number != sLastImpactSample )
+    {
+        sLastImpactSample = nav.number;
+
+        const auto& fusion{ nav.fusion };
+        if ( ImpactDetector::isImpact(
+                 { .x = fusion.linAccelX, .y = fusion.linAccelY, .z = fusion.linAccelZ } ) )
+        {
+            sayStop( link, "impact" );
+        }
+    }
+}
 
 // ********************** Pulse LED event handlers
 
@@ -243,7 +407,22 @@ void PulsePicoLedHandler::handleEvent( EventManager& events, SerialLink& link,
 
 // ********************** Battery event handlers
 
-// Go here
+void BatteryLowHandler::handleEvent( EventManager& events, SerialLink& link,
+                                     EvtId eventCode, int eventParam,
+                                     std::uint32_t eventTime ) const
+{
+    // Batteries only raises this once per drop below the threshold, so
+    // tell the RPi0 even if it hasn't asked for battery msgs
+    Battery which{ static_cast<Battery>( eventParam ) };
+    std::uint16_t raw{ which == Battery::kMotorBattery
+                           ? Batteries::getMotorBatteryRaw()
+                           : Batteries::getIcBatteryRaw() };
+
+    output2cout( "Battery low:", eventParam, raw );
+
+    BatteryLevelUpdateMsg lowMsg( which, raw );
+    lowMsg.sendOut( link );
+}
 
 // ********************** Pico Reset event handlers
 
@@ -74,6 +74,14 @@ public:
                               std::uint32_t eventTime ) const;
 };
 
+class BNO055InitFinishedHandler : public EventHandler
+{
+public:
+    virtual void handleEvent( EventManager& events, SerialLink& link,
+                              EvtId eventCode, int eventParam,
+                              std::uint32_t eventTime ) const;
+};
+
 class BNO055ResetHandler : public EventHandler
 {
 public:
@@ -98,9 +106,15 @@ public:
                               std::uint32_t eventTime ) const;
 };
 
-// ********************** Encoder event handlers
+class BNO055ProfileReadHandler : public EventHandler
+{
+public:
+    virtual void handleEvent( EventManager& events, SerialLink& link,
+                              EvtId eventCode, int eventParam,
+                              std::uint32_t eventTime ) const;
+};
 
-class EncoderLeftEventHandler : public EventHandler
+class BNO055ProfileDoneHandler : public EventHandler
 {
 public:
     virtual void handleEvent( EventManager& events, SerialLink& link,
@@ -108,7 +122,9 @@ public:
                               std::uint32_t eventTime ) const;
 };
 
-class EncoderRightEventHandler : public EventHandler
+// ********************** Impact detection event handlers
+
+class ImpactCheckHandler : public EventHandler
 {
 public:
     virtual void handleEvent( EventManager& events, SerialLink& link,
@@ -128,7 +144,13 @@ public:
 
 // ********************** Battery event handlers
 
-// Go here
+class BatteryLowHandler : public EventHandler
+{
+public:
+    virtual void handleEvent( EventManager& events, SerialLink& link,
+                              EvtId eventCode, int eventParam,
+                              std::uint32_t eventTime ) const;
+};
 
 // ********************** Pico Reset handlers
 
@@ -17,12 +17,11 @@
     along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#define EVENTMANAGER_EVENT_QUEUE_SIZE 24
-
 #include "EventManager.h"
 
+#include <hardware/sync.h>
+#include <hardware/timer.h>
 #include <pico/stdlib.h>
-#include <pico/util/queue.h>
 
 #include <utility>
 
@@ -57,30 +56,29 @@
 
 EventManager gEventManagerInstance;
 
-EventManager::~EventManager()
-{
-    queue_free( &mHighPriorityQueue );
-    queue_free( &mLowPriorityQueue );
-}
+EventManager::~EventManager() {}
 
 EventManager::EventManager()
-    : mQueueOverflowOccurred{ false }
+    : mQueues{}, mQueueOverflowOccurred{ false }
 {
-    queue_init( &mHighPriorityQueue, sizeof( Event ),
-                EVENTMANAGER_EVENT_QUEUE_SIZE );
-    queue_init( &mLowPriorityQueue, sizeof( Event ),
-                EVENTMANAGER_EVENT_QUEUE_SIZE );
+    mQueues.setAgingUs( kLowPriority, EVENTMANAGER_LOW_PRIORITY_AGING_US );
 }
 
 bool EventManager::getNextEvent( EvtId* eventCode, int* param,
-                                 std::uint32_t* time )
+                                 std::uint32_t* time, std::uint32_t* queuedAt )
+{
+    return getNextEvent( kLowPriority, eventCode, param, time, queuedAt );
+}
+
+bool EventManager::getNextEvent( EventPriority pri, EvtId* eventCode,
+                                 int* param, std::uint32_t* time,
+                                 std::uint32_t* queuedAt )
 {
     Event e;
 
-    // Try high-pri first; if no high-pri, event try low-pri
-    if ( queue_try_remove( &mHighPriorityQueue, reinterpret_cast<void*>( &e ) )
-         || queue_try_remove( &mLowPriorityQueue,
-                              reinterpret_cast<void*>( &e ) ) )
+    // Highest priority first; oldest first among equals, so a busy Core1
+    // can't starve events posted by Core0 (or vice versa)
+    if ( mQueues.tryPop( time_us_32(), &e, queuedAt, nullptr, pri ) )
     {
         *eventCode = static_cast<EvtId>( e.mCode );
         *param = e.mParam;
@@ -96,33 +94,27 @@ bool EventManager::getNextEvent( EvtId* eventCode, int* param,
 
 void EventManager::reset()
 {
-    queue_free( &mHighPriorityQueue );
-    queue_free( &mLowPriorityQueue );
-
-    queue_init( &mHighPriorityQueue, sizeof( Event ),
-                EVENTMANAGER_EVENT_QUEUE_SIZE );
-    queue_init( &mLowPriorityQueue, sizeof( Event ),
-                EVENTMANAGER_EVENT_QUEUE_SIZE );
+    // Consumer-side purge; producers can keep posting while this happens
+    mQueues.clear();
 
     mQueueOverflowOccurred = false;
 }
 
 bool EventManager::isEventQueueEmpty( EventPriority pri )
 {
-    return ( pri == kHighPriority ) ? queue_is_empty( &mHighPriorityQueue )
-                                    : queue_is_empty( &mLowPriorityQueue );
+    return mQueues.isEmpty( pri );
 }
 
+bool EventManager::areAllEventQueuesEmpty() { return mQueues.isEmpty(); }
+
 bool EventManager::isEventQueueFull( EventPriority pri )
 {
-    return ( pri == kHighPriority ) ? queue_is_full( &mHighPriorityQueue )
-                                    : queue_is_full( &mLowPriorityQueue );
+    return mQueues.isFull( pri, get_core_num() );
 }
 
 int EventManager::getNumEventsInQueue( EventPriority pri )
 {
-    return ( pri == kHighPriority ) ? queue_get_level( &mHighPriorityQueue )
-                                    : queue_get_level( &mLowPriorityQueue );
+    return static_cast<int>( mQueues.size( pri ) );
 }
 
 bool EventManager::queueEvent( EvtId eventCode, int eventParam,
@@ -130,14 +122,19 @@ bool EventManager::queueEvent( EvtId eventCode, int eventParam,
 {
     Event e{ std::to_underlying( eventCode ), eventParam, eventTime };
 
+    // Only this core ever pushes into its own queue; masking interrupts
+    // (on this core only) keeps an ISR from interleaving with thread code
+    std::uint32_t irqStatus{ save_and_disable_interrupts() };
     // Don't block: caller deals with failure to add
-    bool success = ( pri == kHighPriority )
-                       ? queue_try_add( &mHighPriorityQueue,
-                                        reinterpret_cast<void*>( &e ) )
-                       : queue_try_add( &mLowPriorityQueue,
-                                        reinterpret_cast<void*>( &e ) );
+    bool success{ mQueues.tryPush( pri, get_core_num(), e, time_us_32() ) };
+    restore_interrupts( irqStatus );
 
-    if ( !success )
+    if ( success )
+    {
+        // Wake Core0 if it is idling in __wfe() (SEV reaches both cores)
+        __sev();
+    }
+    else
     {
         // Queue overflow flag is intentionally "sicky": once on,
         // stays on until explicitly reset.
@@ -155,3 +152,10 @@ void EventManager::resetEventQueueOverflowFlag()
 {
     mQueueOverflowOccurred = false;
 }
+
+EventManager::QueueStats EventManager::getQueueStats( EventPriority pri )
+{
+    return mQueues.getStats( pri );
+}
+
+void EventManager::resetQueueStats() { mQueues.resetStats(); }
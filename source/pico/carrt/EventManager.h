@@ -21,25 +21,45 @@
 #define EventManager_h
 
 #include <pico/stdlib.h>
-#include <pico/util/queue.h>
 
+#include <atomic>
 #include <cstdint>
 
 #include "Event.h"    // This is where events themselves are defined
+#include "MultiLevelQueue.hpp"
+
+// Queue sizes (per core) must be powers of 2 (SpscQueue requirement)
+#ifndef EVENTMANAGER_EVENT_QUEUE_SIZE
+    #define EVENTMANAGER_EVENT_QUEUE_SIZE 32
+#endif    // EVENTMANAGER_EVENT_QUEUE_SIZE
+
+#ifndef EVENTMANAGER_URGENT_QUEUE_SIZE
+    #define EVENTMANAGER_URGENT_QUEUE_SIZE 8
+#endif    // EVENTMANAGER_URGENT_QUEUE_SIZE
+
+// Low priority events that have waited this long compete with high
+// priority events (0 turns aging off)
+#ifndef EVENTMANAGER_LOW_PRIORITY_AGING_US
+    #define EVENTMANAGER_LOW_PRIORITY_AGING_US 50000
+#endif    // EVENTMANAGER_LOW_PRIORITY_AGING_US
 
 class EventManager
 {
 public:
-    // EventManager recognizes two kinds of events.  By default, events
+    // EventManager recognizes three kinds of events.  By default, events
     // are queued as low priority, but these constants can be used to
     // explicitly set the priority when queueing events
     //
-    // NOTE: high priority events are always handled before any
-    // low priority events.
+    // NOTE: urgent events (errors) are always handled first, then high
+    // priority events.  Low priority events wait for both, except that
+    // one that has waited EVENTMANAGER_LOW_PRIORITY_AGING_US is taken in
+    // turn with the high priority events so it can't starve.
     enum EventPriority
     {
         kLowPriority,
-        kHighPriority
+        kHighPriority,
+        kUrgentPriority,
+        kNbrPriorities
     };
 
     // Constructors, destructors, and special members
@@ -58,7 +78,11 @@ public:
     // Returns true if no events are in the queue
     bool isEventQueueEmpty( EventPriority pri = kLowPriority );
 
+    // Returns true if no events of any priority are queued
+    bool areAllEventQueuesEmpty();
+
     // Returns true if no more events can be inserted into the queue
+    // by the calling core
     bool isEventQueueFull( EventPriority pri = kLowPriority );
 
     // Actual number of events in queue
@@ -71,9 +95,18 @@ public:
                      std::uint32_t eventTime = 0,
                      EventPriority pri = kLowPriority );
 
-    // This function returns the next event
+    // This function returns the next event; queuedAt (if requested) is
+    // the time_us_32() at which queueEvent() accepted the event
+    // NOTE: only Core0 takes events out of the queues
     bool getNextEvent( EvtId* eventCode, int* eventParam,
-                       std::uint32_t* eventTime = nullptr );
+                       std::uint32_t* eventTime = nullptr,
+                       std::uint32_t* queuedAt = nullptr );
+
+    // Same, but only takes events of at least the given priority
+    // (counting aged low priority events as high priority)
+    bool getNextEvent( EventPriority pri, EvtId* eventCode, int* eventParam,
+                       std::uint32_t* eventTime = nullptr,
+                       std::uint32_t* queuedAt = nullptr );
 
     // Has the event queue overflowed?
     bool hasEventQueueOverflowed();
@@ -81,19 +114,45 @@ public:
     // Reset the event queue overflow flag
     void resetEventQueueOverflowFlag();
 
+    // Counts of events queued, dropped, taken, and promoted by aging at
+    // the given priority, plus the deepest either core's queue has been
+    using QueueStats = MultiLevelQueueStats;
+    QueueStats getQueueStats( EventPriority pri );
+
+    void resetQueueStats();
+
 private:
     // What events look like
     struct Event
     {
         int mCode;
         int mParam;
-        std::uint32_t mTime;
+        std::uint32_t mTime;    // Whatever the caller supplied
+    };
+
+    enum
+    {
+        kCore0,
+        kCore1,
+        kNbrCores
     };
 
-    queue_t mHighPriorityQueue;
-    queue_t mLowPriorityQueue;
+    // Each core posts events into its own lock-free single-producer,
+    // single-consumer queue (one per priority); Core0 is the only consumer.
+    // Producers on the same core (thread code and interrupt handlers) are
+    // serialized by briefly masking interrupts on that core, which is
+    // much cheaper than a cross-core spin lock.  The queues also record
+    // when each event was queued (for aging and profiling).
+    using EventQueues = MultiLevelQueue<Event, kNbrCores,
+                                        EVENTMANAGER_EVENT_QUEUE_SIZE,
+                                        EVENTMANAGER_EVENT_QUEUE_SIZE,
+                                        EVENTMANAGER_URGENT_QUEUE_SIZE>;
+
+    static_assert( EventQueues::kNbrLevels == kNbrPriorities );
+
+    EventQueues mQueues;
 
-    bool mQueueOverflowOccurred;
+    std::atomic<bool> mQueueOverflowOccurred;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
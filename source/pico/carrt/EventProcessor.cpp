@@ -20,40 +20,80 @@
 
 #include "EventProcessor.h"
 
+#include <hardware/timer.h>
+
 #include <utility>
 
 #include "CarrtError.h"
 #include "Clock.h"
 #include "EventManager.h"
+#include "EventStats.h"
 #include "OutputUtils.hpp"
 #include "SerialMessages.h"
 
-EventProcessor::EventProcessor( int reserveSize )
+void EventProcessor::dispatchOneEvent( EventManager& events,
+                                       SerialLink& link ) const
 {
-    mHandlers.reserve( reserveSize );
+    EvtId eventCode;
+    int eventParam;
+    std::uint32_t eventTime;
+    std::uint32_t queuedAt;
+
+    if ( events.getNextEvent( &eventCode, &eventParam, &eventTime,
+                              &queuedAt ) )
+    {
+        dispatch( events, link, eventCode, eventParam, eventTime, queuedAt );
+    }
 }
 
-void EventProcessor::dispatchOneEvent( EventManager& events,
-                                       SerialLink& link ) const
+int EventProcessor::dispatchAll( EventManager& events, SerialLink& link ) const
 {
     EvtId eventCode;
     int eventParam;
     std::uint32_t eventTime;
+    std::uint32_t queuedAt;
+    int count{ 0 };
+
+    while ( events.getNextEvent( EventManager::kHighPriority, &eventCode,
+                                 &eventParam, &eventTime, &queuedAt ) )
+    {
+        dispatch( events, link, eventCode, eventParam, eventTime, queuedAt );
+        ++count;
+    }
+
+    for ( int i = 0; i < kMaxLowPriorityPerDispatch
+                     && events.getNextEvent( EventManager::kLowPriority,
+                                             &eventCode, &eventParam,
+                                             &eventTime, &queuedAt );
+          ++i )
+    {
+        dispatch( events, link, eventCode, eventParam, eventTime, queuedAt );
+        ++count;
+    }
+
+    return count;
+}
+
+void EventProcessor::dispatch( EventManager& events, SerialLink& link,
+                               EvtId eventCode, int eventParam,
+                               std::uint32_t eventTime,
+                               std::uint32_t queuedAt ) const
+{
+    std::uint32_t start{ time_us_32() };
 
-    if ( events.getNextEvent( &eventCode, &eventParam, &eventTime ) )
+    auto idNum{ static_cast<std::size_t>( std::to_underlying( eventCode ) ) };
+    if ( idNum < kNbrEventIds && mHandlers[ idNum ] )
     {
-        auto handler{ mHandlers.find( std::to_underlying( eventCode ) ) };
-        if ( handler == mHandlers.end() )
-        {
-            handleUnknownEvent( events, link, eventCode, eventParam,
-                                eventTime );
-        }
-        else
-        {
-            handler->second->handleEvent( events, link, eventCode, eventParam,
-                                          eventTime );
-        }
+        mHandlers[ idNum ]->handleEvent( events, link, eventCode, eventParam,
+                                         eventTime );
     }
+    else
+    {
+        handleUnknownEvent( events, link, eventCode, eventParam, eventTime );
+    }
+
+    // Unsigned subtraction handles timer wrap (every ~71 minutes)
+    EventStats::record( eventCode, start - queuedAt, time_us_32() - start );
 }
 
 void EventProcessor::handleUnknownEvent( EventManager& events, SerialLink& link,
@@ -21,9 +21,9 @@
 #ifndef EventProcessor_h
 #define EventProcessor_h
 
-#include <memory>
+#include <array>
+#include <cstddef>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 
 #include "CarrtError.h"
@@ -33,9 +33,9 @@
 class EventProcessor
 {
 public:
-    using EventHandlerPtr = typename std::unique_ptr<EventHandler>;
+    using EventHandlerPtr = EventHandler*;
 
-    EventProcessor( int reserveSize );
+    EventProcessor() = default;
 
     ~EventProcessor() = default;
 
@@ -46,6 +46,15 @@ public:
 
     void dispatchOneEvent( EventManager& events, SerialLink& link ) const;
 
+    // Dispatch every pending urgent and high priority event (including
+    // low priority events that have aged into high), then at most
+    // kMaxLowPriorityPerDispatch low priority events.
+    // Returns the number of events dispatched
+    int dispatchAll( EventManager& events, SerialLink& link ) const;
+
+    // Bounds the time dispatchAll() keeps serial messages waiting
+    static constexpr int kMaxLowPriorityPerDispatch{ 4 };
+
     template<typename T>
     void registerHandler( EvtId id )
     {
@@ -53,16 +62,15 @@ public:
                        "EventProcessor::registerHandler: handlers must derive "
                        "from EventHandler" );
         int idNum = std::to_underlying( id );
-        if ( mHandlers.find( idNum ) != mHandlers.end() )
-        {
-            throw CarrtError(
-                makeSharedErrorId( kEventHandlerDupeError, 1, idNum ),
-                "Id dupe at event registation" );
-        }
-        mHandlers[ idNum ] = std::make_unique<T>();
+        checkIdForRegistration( idNum, 1 );
+        // Handlers are stateless (handleEvent() is const), so one static
+        // instance per handler type serves every id it is registered for
+        static T sHandler;
+        mHandlers[ idNum ] = &sHandler;
     }
 
-    // Useful in case T constructor needs arguments
+    // Useful in case T constructor needs arguments; the caller keeps
+    // ownership and the handler must outlive the EventProcessor
     template<typename T>
     void registerHandler( EvtId id, T* ptr )
     {
@@ -70,21 +78,41 @@ public:
                        "EventProcessor::registerHandler: handlers must derive "
                        "from EventHandler" );
         int idNum = std::to_underlying( id );
-        if ( mHandlers.find( idNum ) != mHandlers.end() )
+        checkIdForRegistration( idNum, 2 );
+        mHandlers[ idNum ] = ptr;
+    }
+
+private:
+    // EvtId is dense, so handlers live in a table indexed by EvtId
+    static constexpr std::size_t kNbrEventIds{ static_cast<std::size_t>(
+        std::to_underlying( EvtId::kLastEvent ) ) };
+
+    void checkIdForRegistration( int idNum, int where ) const
+    {
+        if ( idNum < 0 || idNum >= static_cast<int>( kNbrEventIds ) )
         {
-            throw CarrtError(
-                makeSharedErrorId( kEventHandlerDupeError, 2, idNum ),
+            raiseCarrtError(
+                makeSharedErrorId( kEventHandlerRangeError, where, idNum ),
+                "Id out of range at event registation" );
+        }
+        if ( mHandlers[ idNum ] )
+        {
+            raiseCarrtError(
+                makeSharedErrorId( kEventHandlerDupeError, where, idNum ),
                 "Id dupe at event registation" );
         }
-        mHandlers[ idNum ] = std::unique_ptr<T>( ptr );
     }
 
-private:
+    // Also records queue latency and handler time in EventStats
+    void dispatch( EventManager& events, SerialLink& link, EvtId eventCode,
+                   int eventParam, std::uint32_t eventTime,
+                   std::uint32_t queuedAt ) const;
+
     void handleUnknownEvent( EventManager& events, SerialLink& link,
                              EvtId eventCode, int eventParam,
                              std::uint32_t eventTime ) const;
 
-    std::unordered_map<int, EventHandlerPtr> mHandlers;
+    std::array<EventHandlerPtr, kNbrEventIds> mHandlers{};
 };
 
 #endif    // EventProcessor_h
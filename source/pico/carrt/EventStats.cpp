@@ -0,0 +1,120 @@
+/*
+    EventStats.cpp - Event-loop profiling for CARRT-Pico: per-EvtId
+    histograms of queue latency and handler execution time
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "EventStats.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <utility>
+
+namespace
+{
+    constexpr std::size_t kNbrEventIds{ static_cast<std::size_t>(
+        std::to_underlying( EvtId::kLastEvent ) ) };
+
+    EventStats::Histogram sLatency[ kNbrEventIds ];
+    EventStats::Histogram sExecution[ kNbrEventIds ];
+
+    void add( EventStats::Histogram& h, std::uint32_t us ) noexcept
+    {
+        ++h.mCounts[ EventStats::bucketFor( us ) ];
+        h.mMaxUs = std::max( h.mMaxUs, us );
+    }
+
+    bool inRange( EvtId id ) noexcept
+    {
+        return static_cast<std::size_t>( std::to_underlying( id ) )
+               < kNbrEventIds;
+    }
+
+}    // namespace
+
+int EventStats::bucketFor( std::uint32_t us ) noexcept
+{
+    // Buckets are powers of 4 starting at 16 us: <16, <64, <256, ...
+    // bit_width() is 5 or 6 for [16, 64), 7 or 8 for [64, 256), etc.
+    int width{ static_cast<int>( std::bit_width( us ) ) };
+    if ( width <= 4 )
+    {
+        return 0;
+    }
+    return std::min( ( width - 3 ) / 2, kEventStatsNbrBuckets - 1 );
+}
+
+void EventStats::record( EvtId id, std::uint32_t latencyUs,
+                         std::uint32_t executionUs ) noexcept
+{
+    if ( inRange( id ) )
+    {
+        auto idNum{ std::to_underlying( id ) };
+        add( sLatency[ idNum ], latencyUs );
+        add( sExecution[ idNum ], executionUs );
+    }
+}
+
+bool EventStats::hasSamples( EvtId id ) noexcept
+{
+    // Every dispatch lands in some latency bucket
+    const Histogram* h{ get( id, EventStatsKind::kQueueLatency ) };
+    return h && std::ranges::any_of( h->mCounts,
+                                     []( std::uint32_t n ) { return n != 0; } );
+}
+
+const EventStats::Histogram* EventStats::get( EvtId id,
+                                              EventStatsKind kind ) noexcept
+{
+    if ( !inRange( id ) )
+    {
+        return nullptr;
+    }
+
+    auto idNum{ std::to_underlying( id ) };
+    return ( kind == EventStatsKind::kQueueLatency ) ? &sLatency[ idNum ]
+                                                     : &sExecution[ idNum ];
+}
+
+void EventStats::sendAll( SerialLink& link )
+{
+    for ( std::size_t i = 0; i < kNbrEventIds; ++i )
+    {
+        auto id{ static_cast<EvtId>( i ) };
+        if ( hasSamples( id ) )
+        {
+            for ( auto kind : { EventStatsKind::kQueueLatency,
+                                EventStatsKind::kExecutionTime } )
+            {
+                const Histogram* h{ get( id, kind ) };
+                EventStatsMsg msg( static_cast<std::uint8_t>( i ), kind,
+                                   h->mMaxUs, h->mCounts );
+                msg.sendOut( link );
+            }
+        }
+    }
+}
+
+void EventStats::reset() noexcept
+{
+    for ( std::size_t i = 0; i < kNbrEventIds; ++i )
+    {
+        sLatency[ i ] = Histogram{};
+        sExecution[ i ] = Histogram{};
+    }
+}
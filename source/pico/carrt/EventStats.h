@@ -0,0 +1,61 @@
+/*
+    EventStats.h - Event-loop profiling for CARRT-Pico: per-EvtId
+    histograms of queue latency (time from queueEvent() to dispatch)
+    and handler execution time
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef EventStats_h
+#define EventStats_h
+
+#include <cstdint>
+
+#include "Event.h"
+#include "SerialMessages.h"
+
+// All of these are called only from Core0 (the event loop and the
+// message handlers), so no locking is needed
+namespace EventStats
+{
+    struct Histogram
+    {
+        std::uint32_t mMaxUs;
+        EventStatsCounts mCounts;
+    };
+
+    // Which bucket a sample of the given duration lands in
+    int bucketFor( std::uint32_t us ) noexcept;
+
+    // Record one dispatch of the given event (times in us);
+    // events outside the EvtId range are ignored
+    void record( EvtId id, std::uint32_t latencyUs,
+                 std::uint32_t executionUs ) noexcept;
+
+    // Have any events with this id been recorded?
+    bool hasSamples( EvtId id ) noexcept;
+
+    // Returns nullptr for events outside the EvtId range
+    const Histogram* get( EvtId id, EventStatsKind kind ) noexcept;
+
+    // Send an EventStatsMsg for each kind, for each EvtId with samples
+    void sendAll( SerialLink& link );
+
+    void reset() noexcept;
+
+};    // namespace EventStats
+
+#endif    // EventStats_h
@@ -0,0 +1,136 @@
+/*
+    ImpactDetector.cpp - Impact and wheel stall detection for CARRT-Pico
+
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "ImpactDetector.h"
+
+#include <cstdint>
+
+#include "CarrtPicoDefines.h"
+#include "Clock.h"
+#include "Core1.h"
+#include "Event.h"
+#include "EventManager.h"
+
+namespace
+{
+    constexpr std::uint32_t square( std::uint16_t x )
+    {
+        return static_cast<std::uint32_t>( x ) * x;
+    }
+
+    // Only used on Core0
+    bool sEnabled{ true };
+    std::uint32_t sAccelThresholdSquared{ square( CARRTPICO_IMPACT_ACCEL_THRESHOLD ) };
+    std::uint32_t sStallUs{ CARRTPICO_IMPACT_STALL_MS * 1000u };
+
+    bool sDriving{ false };
+    bool sWatching{ false };
+    std::uint32_t sWatchStartUs{ 0 };
+    Core1::ScheduledEventId sCheckTick{ Core1::kNoScheduledEvent };
+
+    void startChecks();
+    void stopChecks();
+    bool stalled( std::uint32_t lastEdgeUs, std::uint32_t nowUs ) noexcept;
+
+}    // namespace
+
+void ImpactDetector::configure( bool enable, std::uint16_t accelThreshold,
+                                std::uint16_t stallMs )
+{
+    sEnabled = enable;
+    sAccelThresholdSquared = square( accelThreshold );
+    sStallUs = stallMs * 1000u;
+
+    setDriving( sDriving );
+}
+
+void ImpactDetector::setDriving( bool driving )
+{
+    sDriving = driving;
+
+    stopChecks();
+    if ( sDriving && sEnabled )
+    {
+        startChecks();
+    }
+}
+
+bool ImpactDetector::isDriving() noexcept { return sDriving; }
+
+bool ImpactDetector::isWatching() noexcept { return sWatching; }
+
+bool ImpactDetector::wheelsStalled( const Encoders::Counts& counts,
+                                    std::uint32_t nowUs ) noexcept
+{
+    if ( !sWatching || !sStallUs )
+    {
+        return false;
+    }
+
+    return stalled( counts.leftLastEdgeTime, nowUs )
+           || stalled( counts.rightLastEdgeTime, nowUs );
+}
+
+bool ImpactDetector::isImpact( const BNO055::LinearAccel& accel ) noexcept
+{
+    if ( !sWatching || !sAccelThresholdSquared )
+    {
+        return false;
+    }
+
+    // Squares of int16 fit in uint32 (even summed)
+    std::uint32_t xSquared{ static_cast<std::uint32_t>( accel.x * accel.x ) };
+    std::uint32_t ySquared{ static_cast<std::uint32_t>( accel.y * accel.y ) };
+    return xSquared + ySquared > sAccelThresholdSquared;
+}
+
+void ImpactDetector::tripped() { stopChecks(); }
+
+namespace
+{
+
+    void startChecks()
+    {
+        sWatching = true;
+        sWatchStartUs = Clock::micros();
+        sCheckTick = Core1::scheduleEvent( EvtId::kImpactCheckEvent, 0, CARRTPICO_IMPACT_CHECK_US,
+                                           CARRTPICO_IMPACT_CHECK_US,
+                                           EventManager::kHighPriority );
+    }
+
+    void stopChecks()
+    {
+        // A check already queued finds sWatching false and does nothing
+        Core1::cancelScheduledEvent( sCheckTick );
+        sCheckTick = Core1::kNoScheduledEvent;
+        sWatching = false;
+    }
+
+    bool stalled( std::uint32_t lastEdgeUs, std::uint32_t nowUs ) noexcept
+    {
+        // Wrap-safe "later of" the last edge and the start of driving
+        std::uint32_t since{ static_cast<std::int32_t>( lastEdgeUs - sWatchStartUs ) > 0
+                                 ? lastEdgeUs
+                                 : sWatchStartUs };
+        return nowUs - since > sStallUs;
+    }
+
+}    // namespace
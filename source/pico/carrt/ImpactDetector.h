@@ -0,0 +1,59 @@
+/*
+    ImpactDetector.h - Impact and wheel stall detection for CARRT-Pico
+
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef ImpactDetector_h
+#define ImpactDetector_h
+
+#include <cstdint>
+
+#include "BNO055.h"
+#include "Encoders.h"
+
+// Catches CARRT running into something without waiting for the RPi0 to
+// notice: a spike in the BNO055's horizontal linear acceleration, or a
+// wheel that stops turning.  While driving, Core1 queues a high priority
+// kImpactCheckEvent every CARRTPICO_IMPACT_CHECK_US and the handlers send
+// PicoSaysStopMsg when a check trips.  All of these are called from Core0.
+namespace ImpactDetector
+{
+    // accelThreshold in raw BNO055 units (100 LSB = 1 m/s^2); a zero
+    // accelThreshold or stallMs turns that check off
+    void configure( bool enable, std::uint16_t accelThreshold, std::uint16_t stallMs );
+
+    // From the RPi0's driving status; checks only run while driving
+    void setDriving( bool driving );
+
+    bool isDriving() noexcept;
+
+    bool isWatching() noexcept;
+
+    // True if a wheel has gone the stall time without an edge (counting
+    // from when CARRT started driving, so it has time to get going)
+    bool wheelsStalled( const Encoders::Counts& counts, std::uint32_t nowUs ) noexcept;
+
+    bool isImpact( const BNO055::LinearAccel& accel ) noexcept;
+
+    // After a stop is sent; checks resume with the next driving status
+    void tripped();
+
+};    // namespace ImpactDetector
+
+#endif    // ImpactDetector_h
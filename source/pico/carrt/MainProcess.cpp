@@ -22,6 +22,7 @@
 
 #include <hardware/clocks.h>
 #include <hardware/i2c.h>
+#include <hardware/sync.h>
 #include <hardware/timer.h>
 #include <hardware/uart.h>
 #include <pico/multicore.h>
@@ -33,10 +34,12 @@
 #include "CarrtPicoDefines.h"
 #include "CarrtPicoReset.h"
 #include "Clock.h"
+#include "ConfigStore.h"
 #include "Core1.h"
 #include "EventManager.h"
 #include "EventProcessor.h"
 #include "HeartBeatLed.h"
+#include "MemoryMonitor.h"
 #include "OutputUtils.hpp"
 #include "PicoState.h"
 #include "SerialLinkPico.h"
@@ -50,6 +53,7 @@ namespace MainProcess
                            SerialLinkPico& rpi0 );
     void checkForErrors( EventManager& events, SerialLinkPico& rpi0 );
     void doHouseKeeping( EventManager& events, SerialLinkPico& rpi0 );
+    void waitForWork( EventManager& events, SerialLinkPico& rpi0 );
 
     void doEventQueueOverflowed( SerialLinkPico& rpi0 );
     void doUnknownEvent( SerialLinkPico& rpi0, int eventCode );
@@ -64,19 +68,34 @@ namespace MainProcess
     while ( 1 )
     {
         checkForErrors( events, rpi0 );
-        ep.dispatchOneEvent( events, rpi0 );
+        ep.dispatchAll( events, rpi0 );
         smp.dispatchOneSerialMessage( events, rpi0 );
         if ( PicoState::startUpFinished() )
         {
             doHouseKeeping( events, rpi0 );
         }
-        // Clock::sleep( 10ms );
+        waitForWork( events, rpi0 );
+    }
+}
+
+void MainProcess::waitForWork( EventManager& events, SerialLinkPico& rpi0 )
+{
+    // Sleep Core0 until something happens: queueEvent() does a __sev()
+    // (from either core) and any interrupt taken on Core0, including the
+    // serial link RX wake-up, also ends the __wfe().  Arm the RX wake-up
+    // *before* checking so data arriving after the checks still wakes us.
+    rpi0.armRxWakeup();
+
+    if ( events.areAllEventQueuesEmpty() && !rpi0.isReadable() )
+    {
+        __wfe();
     }
 }
 
 void MainProcess::checkForErrors( EventManager& events, SerialLinkPico& rpi0 )
 {
-    // Notionally a place to check for memory exhaustion, etc.
+    // Throws (so the Pico reports and resets) if memory is about to run out
+    MemoryMonitor::check( rpi0 );
 }
 
 void MainProcess::doHouseKeeping( EventManager& events, SerialLinkPico& rpi0 )
@@ -92,6 +111,9 @@ void MainProcess::doHouseKeeping( EventManager& events, SerialLinkPico& rpi0 )
         // Trigger new calibration
         events.queueEvent( EvtId::kBNO055BeginCalibrationEvent );
     }
+
+    // Keep what the RPi0 configured across resets
+    ConfigStore::saveIfChanged( rpi0 );
 }
 
 void MainProcess::doEventQueueOverflowed( SerialLinkPico& link )
@@ -107,6 +129,6 @@ void MainProcess::doTestPicoReportError()
 {
     output2cout( "Received test Pico error report msg from RPi0" );
 
-    throw CarrtError( makePicoErrorId( kPicoTestError, 1, 1 ),
-                      "CARRT Pico test error sent by request" );
+    raiseCarrtError( makePicoErrorId( kPicoTestError, 1, 1 ),
+                     "CARRT Pico test error sent by request" );
 }
@@ -0,0 +1,154 @@
+/*
+    MemoryMonitor.cpp - Heap and stack watermarks for CARRT-Pico
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "MemoryMonitor.h"
+
+#include <malloc.h>
+#include <pico/multicore.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "CarrtError.h"
+#include "CarrtPicoDefines.h"
+#include "Clock.h"
+#include "OutputUtils.hpp"
+#include "SerialMessages.h"
+
+// From the Pico SDK's linker script: the heap runs from end to
+// __StackLimit; Core0's stack is [__StackBottom, __StackTop) and
+// Core1's starts at __StackOneBottom (PICO_CORE1_STACK_SIZE bytes)
+extern "C"
+{
+    extern char end;
+    extern char __StackLimit;
+    extern std::uint32_t __StackBottom;
+    extern std::uint32_t __StackTop;
+    extern std::uint32_t __StackOneBottom;
+}
+
+namespace
+{
+    constexpr std::uint32_t kStackPaint{ 0xDEAD'BEEF };
+
+    // Leave this many words below Core0's current stack pointer alone
+    // while painting (our own frame and anything an IRQ pushes)
+    constexpr int kCore0PaintMargin{ 32 };
+
+    MemoryMonitor::Usage sWorst{ 0, 0, 0xFFFF'FFFF, { 0xFFFF, 0xFFFF } };
+    std::uint32_t sLastCheck{ 0 };
+
+    void paint( std::uint32_t* from, std::uint32_t* to ) noexcept
+    {
+        for ( volatile std::uint32_t* p = from; p < to; ++p )
+        {
+            *p = kStackPaint;
+        }
+    }
+
+    std::uint16_t untouched( const std::uint32_t* from, const std::uint32_t* to ) noexcept
+    {
+        const volatile std::uint32_t* p{ from };
+        while ( p < to && *p == kStackPaint )
+        {
+            ++p;
+        }
+        return static_cast<std::uint16_t>( ( p - from ) * sizeof( std::uint32_t ) );
+    }
+
+    std::uint32_t* core1StackTop() noexcept
+    {
+        return &__StackOneBottom + PICO_CORE1_STACK_SIZE / sizeof( std::uint32_t );
+    }
+
+    bool worse( const MemoryMonitor::Usage& now ) noexcept
+    {
+        return now.mHeapUsed > sWorst.mHeapUsed || now.mHeapHighWater > sWorst.mHeapHighWater
+               || now.mHeapFree < sWorst.mHeapFree || now.mStackFree[ 0 ] < sWorst.mStackFree[ 0 ]
+               || now.mStackFree[ 1 ] < sWorst.mStackFree[ 1 ];
+    }
+
+}    // namespace
+
+void MemoryMonitor::paintStacks() noexcept
+{
+    // Core1 isn't running yet, so all of its stack is fair game
+    paint( &__StackOneBottom, core1StackTop() );
+
+    auto sp{ static_cast<std::uint32_t*>( __builtin_frame_address( 0 ) ) };
+    paint( &__StackBottom, sp - kCore0PaintMargin );
+}
+
+MemoryMonitor::Usage MemoryMonitor::measure() noexcept
+{
+    struct mallinfo mi{ mallinfo() };
+
+    Usage u;
+    u.mHeapUsed = static_cast<std::uint32_t>( mi.uordblks );
+    u.mHeapHighWater = static_cast<std::uint32_t>( mi.arena );
+    // What malloc hasn't claimed from the heap yet plus what it holds free
+    u.mHeapFree = static_cast<std::uint32_t>( &__StackLimit - &end ) - u.mHeapHighWater
+                  + static_cast<std::uint32_t>( mi.fordblks );
+    u.mStackFree[ 0 ] = untouched( &__StackBottom, &__StackTop );
+    u.mStackFree[ 1 ] = untouched( &__StackOneBottom, core1StackTop() );
+    return u;
+}
+
+void MemoryMonitor::check( SerialLink& link )
+{
+    std::uint32_t now{ Clock::millis() };
+    if ( now - sLastCheck < CARRTPICO_MEMORY_CHECK_MS )
+    {
+        return;
+    }
+    sLastCheck = now;
+
+    Usage u{ measure() };
+
+    if ( worse( u ) )
+    {
+        MemoryStatsMsg msg( u.mHeapUsed, u.mHeapHighWater, u.mHeapFree, u.mStackFree[ 0 ],
+                            u.mStackFree[ 1 ], now );
+        msg.sendOut( link );
+
+        sWorst.mHeapUsed = std::max( sWorst.mHeapUsed, u.mHeapUsed );
+        sWorst.mHeapHighWater = std::max( sWorst.mHeapHighWater, u.mHeapHighWater );
+        sWorst.mHeapFree = std::min( sWorst.mHeapFree, u.mHeapFree );
+        sWorst.mStackFree[ 0 ] = std::min( sWorst.mStackFree[ 0 ], u.mStackFree[ 0 ] );
+        sWorst.mStackFree[ 1 ] = std::min( sWorst.mStackFree[ 1 ], u.mStackFree[ 1 ] );
+    }
+
+    // Give up while there is still room to report it
+    if ( u.mHeapFree < CARRTPICO_MIN_FREE_HEAP )
+    {
+        output2cout( "Heap nearly exhausted, bytes free", u.mHeapFree );
+        raiseCarrtError( makePicoErrorId( kPicoMemoryError, 1, 1 ), "CARRT Pico heap low" );
+    }
+
+    for ( int core = 0; core < 2; ++core )
+    {
+        if ( u.mStackFree[ core ] < CARRTPICO_MIN_FREE_STACK )
+        {
+            output2cout( "Stack nearly exhausted on core", core, "bytes free",
+                         u.mStackFree[ core ] );
+            raiseCarrtError( makePicoErrorId( kPicoMemoryError, 1, 2 + core ),
+                             "CARRT Pico stack low" );
+        }
+    }
+}
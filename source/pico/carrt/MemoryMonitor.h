@@ -0,0 +1,54 @@
+/*
+    MemoryMonitor.h - Heap and stack watermarks for CARRT-Pico
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MemoryMonitor_h
+#define MemoryMonitor_h
+
+#include <cstdint>
+
+class SerialLink;
+
+// Watches for memory running out before it does.  The heap watermark comes
+// from newlib's malloc; each core's stack is painted with a known pattern
+// at start up, and how much of the pattern survives is how much of that
+// stack has never been used.  All of these are called from Core0.
+namespace MemoryMonitor
+{
+    struct Usage
+    {
+        std::uint32_t mHeapUsed;         // Bytes currently malloc'd
+        std::uint32_t mHeapHighWater;    // Bytes malloc has ever claimed
+        std::uint32_t mHeapFree;         // Bytes malloc can still hand out
+        std::uint16_t mStackFree[ 2 ];   // Bytes never touched, per core
+    };
+
+    // Call first thing in main(), before Core1 is launched
+    void paintStacks() noexcept;
+
+    Usage measure() noexcept;
+
+    // Measures at most once every CARRTPICO_MEMORY_CHECK_MS, sends a
+    // MemoryStatsMsg whenever a watermark gets worse, and raises a
+    // CarrtError if headroom drops below CARRTPICO_MIN_FREE_HEAP or
+    // CARRTPICO_MIN_FREE_STACK
+    void check( SerialLink& link );
+
+};    // namespace MemoryMonitor
+
+#endif    // MemoryMonitor_h
@@ -0,0 +1,69 @@
+/*
+    NavRate.cpp - Control of the rate of nav updates for CARRT-Pico
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "NavRate.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "CarrtPicoDefines.h"
+#include "Core1.h"
+#include "Event.h"
+#include "EventManager.h"
+#include "SerialMessages.h"
+
+namespace
+{
+    // 8N1 framing: 10 bits per byte
+    constexpr int kLinkBytesPerSec{ CARRTPICO_SERIAL_LINK_UART_BAUD_RATE / 10 };
+
+    // Worst case: every msg that can go out on each nav tick is enabled
+    constexpr int kBytesPerTick{ static_cast<int>( NavUpdateMsg::kWireSize
+                                                   + ExtendedNavUpdateMsg::kWireSize
+                                                   + PoseUpdateMsg::kWireSize
+                                                   + EncoderUpdateMsg::kWireSize ) };
+
+    int sRateHz{ 0 };
+    Core1::ScheduledEventId sNavTick{ Core1::kNoScheduledEvent };
+
+}    // namespace
+
+int NavRate::maxHzForLink() noexcept
+{
+    return ( kLinkBytesPerSec * kMaxLinkSharePercent ) / ( 100 * kBytesPerTick );
+}
+
+int NavRate::setRate( int hz )
+{
+    hz = std::clamp( hz, kMinHz, std::min( kMaxHz, maxHzForLink() ) );
+
+    if ( hz != sRateHz )
+    {
+        Core1::cancelScheduledEvent( sNavTick );
+
+        std::uint32_t periodUs{ 1'000'000u / static_cast<std::uint32_t>( hz ) };
+        sNavTick = Core1::scheduleEvent( EvtId::kNavUpdateEvent, hz, periodUs, periodUs,
+                                         EventManager::kHighPriority );
+        sRateHz = hz;
+    }
+
+    return sRateHz;
+}
+
+int NavRate::getRate() noexcept { return sRateHz; }
@@ -0,0 +1,47 @@
+/*
+    NavRate.h - Control of the rate of nav updates for CARRT-Pico
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NavRate_h
+#define NavRate_h
+
+// The nav update tick is a periodic event scheduled on Core1, separate
+// from the 1/8 second timer the quarter/1/8 second events derive from.
+// All of these are called from Core0.
+namespace NavRate
+{
+    constexpr int kDefaultHz{ 8 };
+    constexpr int kMinHz{ 1 };
+    constexpr int kMaxHz{ 100 };    // BNO055 fusion output rate (NDOF mode)
+
+    // Share of the serial link (percent) the per-tick nav msgs may use,
+    // leaving room for everything else the Pico sends
+    constexpr int kMaxLinkSharePercent{ 50 };
+
+    // Highest rate the serial link can carry the per-tick msgs at
+    int maxHzForLink() noexcept;
+
+    // Start the nav tick, or change its rate; hz is clamped to
+    // [kMinHz, kMaxHz] and to maxHzForLink().  Returns the rate set.
+    int setRate( int hz );
+
+    int getRate() noexcept;
+
+};    // namespace NavRate
+
+#endif    // NavRate_h
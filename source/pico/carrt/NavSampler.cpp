@@ -0,0 +1,98 @@
+/*
+    NavSampler.cpp - Core1's periodic BNO055 reads, published for Core0
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "NavSampler.h"
+
+#include <cstdint>
+#include <optional>
+
+#include "CarrtPicoDefines.h"
+#include "Clock.h"
+#include "Event.h"
+#include "I2C.h"
+#include "Seqlock.hpp"
+
+namespace
+{
+    // Core1 writes, Core0 reads
+    Seqlock<NavSampler::Sample> sLatest{};
+
+    // Only used on Core1
+    std::uint32_t sNbrSamples{ 0 };
+
+    // Held from submitting a read until it ends, so Core0 can't use the
+    // bus in between
+    std::optional<I2C::BusLock> sBus{};
+
+}    // namespace
+
+void NavSampler::startSample() noexcept
+{
+    if ( sBus )
+    {
+        return;
+    }
+
+    // Core0 only takes the bus for BNO055 set up (mode switches and such),
+    // when there is nothing worth reading anyway
+    sBus.emplace( I2C::BusLock::TryOnly{} );
+    if ( !sBus->ownsBus() || !BNO055::submitFusionStateRead( EvtId::kNullEvent, 0 ) )
+    {
+        sBus.reset();
+    }
+}
+
+void NavSampler::pollSample() noexcept
+{
+    if ( !sBus )
+    {
+        return;
+    }
+
+    // A stuck bus would otherwise keep the read (and so the bus lock, which
+    // Core0's blocking calls wait on) forever
+    I2C::abortOverdueTransfer();
+
+    if ( BNO055::fusionStateReadPending() )
+    {
+        return;
+    }
+
+    sBus.reset();
+
+    Sample s;
+    if ( BNO055::tryFinishFusionStateRead( &s.fusion ) )
+    {
+        s.timeUs = Clock::micros();
+        s.number = ++sNbrSamples;
+        sLatest.write( s );
+    }
+}
+
+bool NavSampler::latest( Sample* sample ) noexcept
+{
+    Sample s;
+    if ( !sLatest.read( &s ) || Clock::micros() - s.timeUs > CARRTPICO_NAV_SAMPLE_MAX_AGE_US )
+    {
+        return false;
+    }
+
+    *sample = s;
+    return true;
+}
@@ -0,0 +1,60 @@
+/*
+    NavSampler.h - Core1's periodic BNO055 reads, published for Core0
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NavSampler_h
+#define NavSampler_h
+
+#include <cstdint>
+
+#include "BNO055.h"
+
+// Once the BNO055 is up, Core1 reads its fusion state every
+// CARRTPICO_NAV_SAMPLE_US (see Core1::startNavSampling()) with the I2C
+// transfer engine and publishes it through a Seqlock.  Core0's handlers
+// just copy out the newest sample, so how long they take (and how soon the
+// next serial msg goes out) no longer depends on the I2C bus.
+namespace NavSampler
+{
+    struct Sample
+    {
+        BNO055::FusionState fusion;
+        std::uint32_t timeUs;    // When Core1 read it
+        std::uint32_t number;    // Counts up from 1 with each sample
+    };
+
+    // Core1 only: submits a read of the BNO055 (holding the I2C bus until
+    // it ends); skips this sample if Core0 has the bus or the last read
+    // is still going
+    void startSample() noexcept;
+
+    // Core1 only: call often (the transfer's end wakes Core1, and so do
+    // Core1's timers); once the read ends, lets go of the bus and publishes
+    // the result (unless the read failed).  A read still going after
+    // CARRTPICO_I2C_TIMEOUT_US is aborted (and counts as failed), so a stuck
+    // bus can't keep the bus lock from Core0.
+    void pollSample() noexcept;
+
+    // Any core (constant time): copies the newest sample into *sample if
+    // it is no older than CARRTPICO_NAV_SAMPLE_MAX_AGE_US; returns false
+    // (leaving *sample alone) if there isn't one
+    bool latest( Sample* sample ) noexcept;
+
+};    // namespace NavSampler
+
+#endif    // NavSampler_h
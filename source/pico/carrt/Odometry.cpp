@@ -0,0 +1,110 @@
+/*
+    Odometry.cpp - Wheel speed and distance from the encoders for CARRT-Pico
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Odometry.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "TelemetryUnits.h"
+
+namespace
+{
+    // Speed LSBs per (edge per us)
+    constexpr std::uint64_t kSpeedScale{ TelemetryUnits::kRawEncoderSpeedLsbPerEdgePerSec
+                                         * 1'000'000ull };
+
+    struct Wheel
+    {
+        std::uint32_t distance;
+        std::uint32_t lastEdgeUs;
+        std::uint16_t speed;
+        bool moving;
+    };
+
+    // Only used on Core0
+    Wheel sLeft{};
+    Wheel sRight{};
+    std::uint32_t sLastUpdateUs{ 0 };
+
+    std::uint16_t speedFor( std::uint32_t edges, std::uint32_t us )
+    {
+        if ( us == 0 )
+        {
+            return std::numeric_limits<std::uint16_t>::max();
+        }
+
+        std::uint64_t speed{ ( edges * kSpeedScale ) / us };
+        return static_cast<std::uint16_t>(
+            std::min<std::uint64_t>( speed, std::numeric_limits<std::uint16_t>::max() ) );
+    }
+
+    void updateWheel( Wheel& wheel, int edges, std::uint32_t lastEdgeUs, std::uint32_t nowUs )
+    {
+        if ( edges > 0 )
+        {
+            auto newEdges{ static_cast<std::uint32_t>( edges ) };
+            wheel.distance += newEdges;
+
+            if ( wheel.moving && lastEdgeUs - wheel.lastEdgeUs < Odometry::kStoppedAfterUs )
+            {
+                // Period measurement: whole edge intervals, timed to the us
+                wheel.speed = speedFor( newEdges, lastEdgeUs - wheel.lastEdgeUs );
+            }
+            else
+            {
+                // Starting off: no previous edge to time from, so count
+                // over the tick
+                wheel.speed = speedFor( newEdges, nowUs - sLastUpdateUs );
+            }
+
+            wheel.lastEdgeUs = lastEdgeUs;
+            wheel.moving = true;
+        }
+        else if ( wheel.moving )
+        {
+            // No edge yet, so the wheel is going no faster than one edge
+            // in the time since the last one
+            std::uint32_t sinceEdgeUs{ nowUs - wheel.lastEdgeUs };
+            if ( sinceEdgeUs >= Odometry::kStoppedAfterUs )
+            {
+                wheel.speed = 0;
+                wheel.moving = false;
+            }
+            else
+            {
+                wheel.speed = std::min( wheel.speed, speedFor( 1, sinceEdgeUs ) );
+            }
+        }
+    }
+
+}    // namespace
+
+Odometry::Wheels Odometry::update( const Encoders::Counts& counts, std::uint32_t nowUs ) noexcept
+{
+    updateWheel( sLeft, counts.left, counts.leftLastEdgeTime, nowUs );
+    updateWheel( sRight, counts.right, counts.rightLastEdgeTime, nowUs );
+    sLastUpdateUs = nowUs;
+
+    return Wheels{ .leftSpeed = sLeft.speed,
+                   .rightSpeed = sRight.speed,
+                   .leftDistance = sLeft.distance,
+                   .rightDistance = sRight.distance };
+}
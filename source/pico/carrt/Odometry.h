@@ -0,0 +1,52 @@
+/*
+    Odometry.h - Wheel speed and distance from the encoders for CARRT-Pico
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef Odometry_h
+#define Odometry_h
+
+#include <cstdint>
+
+#include "Encoders.h"
+
+// Updated from the encoder counts once per nav tick (on Core0).  Units are
+// encoder edges (see TelemetryUnits); the encoders are single channel, so
+// speeds and distances are magnitudes and the RPi0 supplies the direction
+// from what it told the motors to do.
+namespace Odometry
+{
+    // Speed is estimated from the time between edges.  If the wheel has
+    // been still longer than this, the next edges are instead counted over
+    // the nav tick; with no edges, speed decays toward zero and is zero
+    // after this long.
+    constexpr std::uint32_t kStoppedAfterUs{ 500'000 };
+
+    struct Wheels
+    {
+        std::uint16_t leftSpeed;    // 1/16 edge per sec
+        std::uint16_t rightSpeed;
+        std::uint32_t leftDistance;    // Edges since power up (wraps)
+        std::uint32_t rightDistance;
+    };
+
+    // nowUs is from time_us_32()
+    Wheels update( const Encoders::Counts& counts, std::uint32_t nowUs ) noexcept;
+
+};    // namespace Odometry
+
+#endif    // Odometry_h
@@ -22,10 +22,16 @@
 #include "Batteries.h"
 #include "BuildInfo.h"
 #include "Clock.h"
+#include "ConfigStore.h"
 #include "DebugUtils.hpp"
 #include "EventManager.h"
+#include "EventStats.h"
+#include "ImpactDetector.h"
+#include "NavRate.h"
+#include "NavSampler.h"
 #include "OutputUtils.hpp"
 #include "PicoState.h"
+#include "PoseEstimator.h"
 #include "SerialMessages.h"
 
 #if DEBUG_PICO_SERIAL_MSG_HANDLING
@@ -57,9 +63,9 @@ UnknownMsg::UnknownMsg( MsgId id )
 {
     if ( id != MsgId::kUnknownMessage )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kUnknownMessage ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kUnknownMessage ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -261,9 +267,9 @@ VersionMsg::VersionMsg( MsgId id )
 {
     if ( id != MsgId::kVersionMsg )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kVersionMsg ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kVersionMsg ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -324,7 +330,7 @@ PicoReadyMsg::PicoReadyMsg( MsgId id )
 {
     if ( id != MsgId::kPicoReady )
     {
-        throw CarrtError(
+        raiseCarrtError(
             makePicoErrorId( kPicoSerialMessageError, 1, std::to_underlying( MsgId::kPicoReady ) ),
             "Id mismatch at creation" );
     }
@@ -383,9 +389,9 @@ PicoNavStatusUpdateMsg::PicoNavStatusUpdateMsg( MsgId id )
 {
     if ( id != MsgId::kPicoNavStatusUpdate )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kPicoNavStatusUpdate ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kPicoNavStatusUpdate ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -473,9 +479,9 @@ MsgControlMsg::MsgControlMsg( MsgId id )
 {
     if ( id != MsgId::kMsgControlMsg )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kMsgControlMsg ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kMsgControlMsg ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -549,6 +555,37 @@ void ResetPicoMsg::takeAction( EventManager& events, SerialLink& link )
 
 /******************************************************************************/
 
+ResetPicoConfigMsg::ResetPicoConfigMsg() noexcept
+    : NoContentMsg( MsgId::kResetPicoConfig )
+{
+    mNeedsAction = true;
+}
+
+ResetPicoConfigMsg::ResetPicoConfigMsg( MsgId id ) noexcept
+    : NoContentMsg( id )
+{
+    // Nothing to do
+}
+
+void ResetPicoConfigMsg::takeAction( EventManager& events, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        // Defaults take effect now; the flash erase waits until CARRT is
+        // stopped and the link is quiet
+        ConfigStore::factoryReset();
+        mNeedsAction = false;
+
+        // Let RPi0 know it's done
+        ResetPicoConfigMsg ack;
+        ack.sendOut( link );
+
+        output2cout( "Pico got message from RPi0 to reset its config" );
+    }
+}
+
+/******************************************************************************/
+
 TimerEventMsg::TimerEventMsg() noexcept
     : SerialMessage( MsgId::kTimerEventMsg ),
       mContent( MsgId::kTimerEventMsg ),
@@ -572,9 +609,9 @@ TimerEventMsg::TimerEventMsg( MsgId id )
 {
     if ( id != MsgId::kTimerEventMsg )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kTimerEventMsg ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kTimerEventMsg ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -631,9 +668,9 @@ TimerControlMsg::TimerControlMsg( MsgId id )
 {
     if ( id != MsgId::kTimerControl )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kTimerControl ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kTimerControl ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -715,11 +752,17 @@ void RequestCalibrationStatusMsg::takeAction( EventManager& events, SerialLink&
         output2cout( "Got a request calib status msg" );
 
         // Even if PicoState::wantNavStatusMsgs() is false,
-        // we always respond to direct request
-        auto calibData{ BNO055::getCalibration() };
+        // we always respond to direct request (all unreliable if Core1
+        // has no recent BNO055 reading, e.g., mid bring-up)
+        NavSampler::Sample nav{};
+        bool haveReading{ NavSampler::latest( &nav ) };
+        auto calibData{ nav.fusion.calibration };
         bool status = BNO055::calibrationGood( calibData );
 
-        PicoState::navCalibrated( status );
+        if ( haveReading )
+        {
+            PicoState::navCalibrated( status );
+        }
         PicoNavStatusUpdateMsg navReadyStatus( status, calibData.mag, calibData.accel,
                                                calibData.gyro, calibData.system );
         navReadyStatus.sendOut( link );
@@ -754,9 +797,9 @@ CalibrationInfoUpdateMsg::CalibrationInfoUpdateMsg( MsgId id )
 {
     if ( id != MsgId::kCalibrationInfoUpdate )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kCalibrationInfoUpdate ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kCalibrationInfoUpdate ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -819,9 +862,9 @@ SetAutoCalibrateMsg::SetAutoCalibrateMsg( MsgId id )
 {
     if ( id != MsgId::kSetAutoCalibrate )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kSetAutoCalibrate ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kSetAutoCalibrate ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -879,6 +922,71 @@ void ResetBNO055Msg::takeAction( EventManager& events, SerialLink& link )
 
 /******************************************************************************/
 
+CalibrationProfileMsg::CalibrationProfileMsg() noexcept
+    : SerialMessage( MsgId::kCalibrationProfile ),
+      mContent( MsgId::kCalibrationProfile ),
+      mNeedsAction{ false }
+{}
+
+CalibrationProfileMsg::CalibrationProfileMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kCalibrationProfile ),
+      mContent( MsgId::kCalibrationProfile, t ),
+      mNeedsAction{ true }
+{}
+
+CalibrationProfileMsg::CalibrationProfileMsg( const Profile& profile ) noexcept
+    : SerialMessage( MsgId::kCalibrationProfile ),
+      mContent( MsgId::kCalibrationProfile, std::tuple_cat( profile ) ),
+      mNeedsAction{ true }
+{}
+
+CalibrationProfileMsg::CalibrationProfileMsg( MsgId id )
+    : SerialMessage( id ), mContent( MsgId::kCalibrationProfile ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kCalibrationProfile )
+    {
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kCalibrationProfile ) ),
+                         "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void CalibrationProfileMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "Got CalibrationProfileMsg", getIdNum() );
+}
+
+void CalibrationProfileMsg::sendOut( SerialLink& link )
+{
+    mContent.sendOut( link );
+
+    debugCond2cout<kDebugSerialMsgs>( "Sent CalibrationProfileMsg", getIdNum() );
+}
+
+void CalibrationProfileMsg::takeAction( EventManager& events, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        BNO055::saveCalibrationProfile( getProfile() );
+        mNeedsAction = false;
+
+        output2cout( "Got BNO055 calibration profile from RPi0" );
+
+        // Before start up finishes, the pending BNO055 init applies it;
+        // after, re-init the BNO055 to apply it now
+        if ( PicoState::startUpFinished() )
+        {
+            events.queueEvent( EvtId::kBNO055ResetEvent );
+        }
+    }
+}
+
+/******************************************************************************/
+
 NavUpdateMsg::NavUpdateMsg() noexcept
     : SerialMessage( MsgId::kTimerNavUpdate ),
       mContent( MsgId::kTimerNavUpdate ),
@@ -891,9 +999,9 @@ NavUpdateMsg::NavUpdateMsg( TheData t ) noexcept
       mNeedsAction{ true }
 {}
 
-NavUpdateMsg::NavUpdateMsg( float heading, std::uint32_t time ) noexcept
+NavUpdateMsg::NavUpdateMsg( std::int16_t rawHeading, std::uint32_t time ) noexcept
     : SerialMessage( MsgId::kTimerNavUpdate ),
-      mContent( MsgId::kTimerNavUpdate, std::make_tuple( heading, time ) ),
+      mContent( MsgId::kTimerNavUpdate, std::make_tuple( rawHeading, time ) ),
       mNeedsAction{ true }
 {}
 
@@ -904,9 +1012,9 @@ NavUpdateMsg::NavUpdateMsg( MsgId id )
 {
     if ( id != MsgId::kTimerNavUpdate )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kTimerNavUpdate ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kTimerNavUpdate ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -940,6 +1048,138 @@ void NavUpdateMsg::takeAction( EventManager& events, SerialLink& link )
 
 /******************************************************************************/
 
+ExtendedNavUpdateMsg::ExtendedNavUpdateMsg() noexcept
+    : SerialMessage( MsgId::kExtendedNavUpdate ),
+      mContent( MsgId::kExtendedNavUpdate ),
+      mNeedsAction{ false }
+{}
+
+ExtendedNavUpdateMsg::ExtendedNavUpdateMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kExtendedNavUpdate ),
+      mContent( MsgId::kExtendedNavUpdate, t ),
+      mNeedsAction{ true }
+{}
+
+ExtendedNavUpdateMsg::ExtendedNavUpdateMsg( const Triplet& euler, const Triplet& gyro,
+                                            const Triplet& linAccel, std::uint8_t calibration,
+                                            std::uint32_t time ) noexcept
+    : SerialMessage( MsgId::kExtendedNavUpdate ),
+      mContent( MsgId::kExtendedNavUpdate,
+                std::tuple_cat( euler, gyro, linAccel, std::make_tuple( calibration, time ) ) ),
+      mNeedsAction{ true }
+{}
+
+ExtendedNavUpdateMsg::ExtendedNavUpdateMsg( MsgId id )
+    : SerialMessage( MsgId::kExtendedNavUpdate ),
+      mContent( MsgId::kExtendedNavUpdate ),
+      mNeedsAction{ false }
+{
+    if ( id != MsgId::kExtendedNavUpdate )
+    {
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kExtendedNavUpdate ) ),
+                         "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void ExtendedNavUpdateMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = false;
+
+    output2cout( "Error: got ExtendedNavUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ),
+                 std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ),
+                 std::get<5>( mContent.mMsg ), static_cast<int>( std::get<9>( mContent.mMsg ) ),
+                 std::get<10>( mContent.mMsg ) );
+}
+
+void ExtendedNavUpdateMsg::sendOut( SerialLink& link )
+{
+    mContent.sendOut( link );
+
+    debugCond2cout<kDebugSerialMsgs>( "Sent ExtendedNavUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ),
+                                      std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ),
+                                      std::get<5>( mContent.mMsg ), static_cast<int>( std::get<9>( mContent.mMsg ) ),
+                                      std::get<10>( mContent.mMsg ) );
+}
+
+void ExtendedNavUpdateMsg::takeAction( EventManager& events, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        // This message should only be sent, not received
+        output2cout( "Error: Trying to takeAction() on local Msg", getIdNum() );
+        mNeedsAction = false;
+    }
+}
+
+/******************************************************************************/
+
+PoseUpdateMsg::PoseUpdateMsg() noexcept
+    : SerialMessage( MsgId::kPoseUpdate ),
+      mContent( MsgId::kPoseUpdate ),
+      mNeedsAction{ false }
+{}
+
+PoseUpdateMsg::PoseUpdateMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kPoseUpdate ),
+      mContent( MsgId::kPoseUpdate, t ),
+      mNeedsAction{ true }
+{}
+
+PoseUpdateMsg::PoseUpdateMsg( std::int32_t x, std::int32_t y, std::int16_t rawHeading,
+                              std::uint32_t time ) noexcept
+    : SerialMessage( MsgId::kPoseUpdate ),
+      mContent( MsgId::kPoseUpdate, std::make_tuple( x, y, rawHeading, time ) ),
+      mNeedsAction{ true }
+{}
+
+PoseUpdateMsg::PoseUpdateMsg( MsgId id )
+    : SerialMessage( MsgId::kPoseUpdate ),
+      mContent( MsgId::kPoseUpdate ),
+      mNeedsAction{ false }
+{
+    if ( id != MsgId::kPoseUpdate )
+    {
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kPoseUpdate ) ),
+                         "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void PoseUpdateMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = false;
+
+    output2cout( "Error: got PoseUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ),
+                 std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ),
+                 std::get<3>( mContent.mMsg ) );
+}
+
+void PoseUpdateMsg::sendOut( SerialLink& link )
+{
+    mContent.sendOut( link );
+
+    debugCond2cout<kDebugSerialMsgs>( "Sent PoseUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ),
+                                      std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ),
+                                      std::get<3>( mContent.mMsg ) );
+}
+
+void PoseUpdateMsg::takeAction( EventManager& events, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        // This message should only be sent, not received
+        output2cout( "Error: Trying to takeAction() on local Msg", getIdNum() );
+        mNeedsAction = false;
+    }
+}
+
+/******************************************************************************/
+
 NavUpdateControlMsg::NavUpdateControlMsg() noexcept
     : SerialMessage( MsgId::kNavUpdateControl ),
       mContent( MsgId::kNavUpdateControl ),
@@ -952,11 +1192,14 @@ NavUpdateControlMsg::NavUpdateControlMsg( TheData t ) noexcept
       mNeedsAction{ true }
 {}
 
-NavUpdateControlMsg::NavUpdateControlMsg( bool wantNavUpdates, bool wantNavStatus ) noexcept
+NavUpdateControlMsg::NavUpdateControlMsg( bool wantNavUpdates, bool wantNavStatus,
+                                          bool wantExtendedNav, bool wantPose ) noexcept
     : SerialMessage( MsgId::kNavUpdateControl ),
       mContent( MsgId::kNavUpdateControl,
                 std::make_tuple( static_cast<std::uint8_t>( wantNavUpdates ),
-                                 static_cast<std::uint8_t>( wantNavStatus ) ) ),
+                                 static_cast<std::uint8_t>( wantNavStatus ),
+                                 static_cast<std::uint8_t>( wantExtendedNav ),
+                                 static_cast<std::uint8_t>( wantPose ) ) ),
       mNeedsAction{ true }
 {}
 
@@ -965,9 +1208,9 @@ NavUpdateControlMsg::NavUpdateControlMsg( MsgId id )
 {
     if ( id != MsgId::kNavUpdateControl )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kNavUpdateControl ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kNavUpdateControl ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -979,7 +1222,9 @@ void NavUpdateControlMsg::readIn( SerialLink& link )
 
     debugCond2cout<kDebugSerialMsgs>( "Got NavUpdateControlMsg", getIdNum(),
                                       static_cast<bool>( std::get<0>( mContent.mMsg ) ),
-                                      static_cast<bool>( std::get<1>( mContent.mMsg ) ) );
+                                      static_cast<bool>( std::get<1>( mContent.mMsg ) ),
+                                      static_cast<bool>( std::get<2>( mContent.mMsg ) ),
+                                      static_cast<bool>( std::get<3>( mContent.mMsg ) ) );
 }
 
 void NavUpdateControlMsg::sendOut( SerialLink& link )
@@ -993,12 +1238,90 @@ void NavUpdateControlMsg::takeAction( EventManager& events, SerialLink& link )
     {
         bool wantNav{ static_cast<bool>( std::get<0>( mContent.mMsg ) ) };
         bool wantNavStatus{ static_cast<bool>( std::get<1>( mContent.mMsg ) ) };
+        bool wantExtendedNav{ static_cast<bool>( std::get<2>( mContent.mMsg ) ) };
+        bool wantPose{ static_cast<bool>( std::get<3>( mContent.mMsg ) ) };
         PicoState::sendNavMsgs( wantNav );
         PicoState::sendNavStatusMsgs( wantNavStatus );
+        PicoState::sendExtendedNavMsgs( wantExtendedNav );
+        PicoState::sendPoseMsgs( wantPose );
         mNeedsAction = false;
 
         output2cout( "Sending Nav update events to RPi0 set to", wantNav, "Nav status update",
-                     wantNavStatus );
+                     wantNavStatus, "Extended nav update", wantExtendedNav, "Pose update",
+                     wantPose );
+    }
+}
+
+/******************************************************************************/
+
+NavRateControlMsg::NavRateControlMsg() noexcept
+    : SerialMessage( MsgId::kNavRateControl ),
+      mContent( MsgId::kNavRateControl ),
+      mNeedsAction{ false }
+{}
+
+NavRateControlMsg::NavRateControlMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kNavRateControl ),
+      mContent( MsgId::kNavRateControl, t ),
+      mNeedsAction{ true }
+{}
+
+NavRateControlMsg::NavRateControlMsg( std::uint8_t hz ) noexcept
+    : SerialMessage( MsgId::kNavRateControl ),
+      mContent( MsgId::kNavRateControl, std::make_tuple( hz ) ),
+      mNeedsAction{ true }
+{}
+
+NavRateControlMsg::NavRateControlMsg( MsgId id )
+    : SerialMessage( id ), mContent( MsgId::kNavRateControl ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kNavRateControl )
+    {
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kNavRateControl ) ),
+                         "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void NavRateControlMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "Got NavRateControlMsg", getIdNum(),
+                                      static_cast<int>( std::get<0>( mContent.mMsg ) ) );
+}
+
+void NavRateControlMsg::sendOut( SerialLink& link )
+{
+    // This never sent from Pico
+}
+
+void NavRateControlMsg::takeAction( EventManager& events, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        int requested{ std::get<0>( mContent.mMsg ) };
+        int hz{ NavRate::setRate( requested ) };
+        mNeedsAction = false;
+
+        // So ConfigStore saves it
+        PicoState::Config config{ PicoState::getConfig() };
+        config.mNavRateHz = static_cast<std::uint16_t>( hz );
+        PicoState::setConfig( config );
+
+        output2cout( "Nav update rate requested", requested, "set to", hz );
+
+        if ( hz != requested )
+        {
+            // Let RPi0 know it isn't getting what it asked for
+            bool outOfRange{ requested < NavRate::kMinHz || requested > NavRate::kMaxHz };
+            ErrorReportMsg err( kPicoNonFatalError,
+                                makePicoErrorId( kPicoNavRateError, 1, outOfRange ? 1 : 2 ),
+                                Clock::millis() );
+            err.sendOut( link );
+        }
     }
 }
 
@@ -1027,9 +1350,9 @@ DrivingStatusUpdateMsg::DrivingStatusUpdateMsg( MsgId id )
 {
     if ( id != MsgId::kDrivingStatusUpdate )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kDrivingStatusUpdate ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kDrivingStatusUpdate ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -1054,15 +1377,110 @@ void DrivingStatusUpdateMsg::takeAction( EventManager& events, SerialLink& link
     {
         std::uint8_t driveStatus = std::get<0>( mContent.mMsg );
 
-        // TODO take whatever action is appropirate
+        // The encoders can't tell which way the wheels turn, so dead
+        // reckoning takes it from here; when stopped, any coasting is
+        // still in the last direction driven
+        switch ( static_cast<Drive>( driveStatus ) )
+        {
+            case Drive::kDrivingFwd:
+                PoseEstimator::setWheelDirections( 1, 1 );
+                break;
+
+            case Drive::kDrivingBkwd:
+                PoseEstimator::setWheelDirections( -1, -1 );
+                break;
+
+            case Drive::kTurningLeft:
+                PoseEstimator::setWheelDirections( -1, 1 );
+                break;
+
+            case Drive::kTurningRight:
+                PoseEstimator::setWheelDirections( 1, -1 );
+                break;
+
+            case Drive::kStopped:
+            default:
+                break;
+        }
+
+        ImpactDetector::setDriving( static_cast<Drive>( driveStatus ) != Drive::kStopped );
+
         output2cout( "RPi0 sent driving status", static_cast<int>( driveStatus ) );
-        output2cout( "TODO - implement action" );
         mNeedsAction = false;
     }
 }
 
 /******************************************************************************/
 
+ImpactControlMsg::ImpactControlMsg() noexcept
+    : SerialMessage( MsgId::kImpactControl ),
+      mContent( MsgId::kImpactControl ),
+      mNeedsAction{ false }
+{}
+
+ImpactControlMsg::ImpactControlMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kImpactControl ),
+      mContent( MsgId::kImpactControl, t ),
+      mNeedsAction{ true }
+{}
+
+ImpactControlMsg::ImpactControlMsg( bool enable, std::uint16_t accelThreshold,
+                                    std::uint16_t stallMs ) noexcept
+    : SerialMessage( MsgId::kImpactControl ),
+      mContent( MsgId::kImpactControl,
+                std::make_tuple( static_cast<std::uint8_t>( enable ), accelThreshold, stallMs ) ),
+      mNeedsAction{ true }
+{}
+
+ImpactControlMsg::ImpactControlMsg( MsgId id )
+    : SerialMessage( id ), mContent( MsgId::kImpactControl ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kImpactControl )
+    {
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kImpactControl ) ),
+                         "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void ImpactControlMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "Got ImpactControlMsg", getIdNum(),
+                                      static_cast<bool>( std::get<0>( mContent.mMsg ) ),
+                                      std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ) );
+}
+
+void ImpactControlMsg::sendOut( SerialLink& link )
+{
+    // This never sent from Pico
+}
+
+void ImpactControlMsg::takeAction( EventManager& events, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        auto [enable, accelThreshold, stallMs] = mContent.mMsg;
+        ImpactDetector::configure( enable, accelThreshold, stallMs );
+        mNeedsAction = false;
+
+        // So ConfigStore saves them
+        PicoState::Config config{ PicoState::getConfig() };
+        config.mImpactEnabled = enable;
+        config.mImpactAccelThreshold = accelThreshold;
+        config.mImpactStallMs = stallMs;
+        PicoState::setConfig( config );
+
+        output2cout( "Impact detection", static_cast<bool>( enable ), "accel", accelThreshold,
+                     "stall ms", stallMs );
+    }
+}
+
+/******************************************************************************/
+
 EncoderUpdateMsg::EncoderUpdateMsg() noexcept
     : SerialMessage( MsgId::kEncoderUpdate ),
       mContent( MsgId::kEncoderUpdate ),
@@ -1075,9 +1493,12 @@ EncoderUpdateMsg::EncoderUpdateMsg( TheData t ) noexcept
       mNeedsAction{ true }
 {}
 
-EncoderUpdateMsg::EncoderUpdateMsg( Side side, int count, std::uint32_t time ) noexcept
+EncoderUpdateMsg::EncoderUpdateMsg( std::uint16_t leftSpeed, std::uint16_t rightSpeed,
+                                    std::uint32_t leftDistance, std::uint32_t rightDistance,
+                                    std::uint32_t time ) noexcept
     : SerialMessage( MsgId::kEncoderUpdate ),
-      mContent( MsgId::kEncoderUpdate, std::make_tuple( std::to_underlying( side ), count, time ) ),
+      mContent( MsgId::kEncoderUpdate, std::make_tuple( leftSpeed, rightSpeed, leftDistance,
+                                                        rightDistance, time ) ),
       mNeedsAction{ true }
 {}
 
@@ -1086,9 +1507,9 @@ EncoderUpdateMsg::EncoderUpdateMsg( MsgId id )
 {
     if ( id != MsgId::kEncoderUpdate )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kEncoderUpdate ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kEncoderUpdate ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -1099,7 +1520,8 @@ void EncoderUpdateMsg::readIn( SerialLink& link )
     mNeedsAction = false;
 
     output2cout( "Error: got EncoderUpdateMsg", std::get<0>( mContent.mMsg ),
-                 std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ) );
+                 std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ),
+                 std::get<3>( mContent.mMsg ), std::get<4>( mContent.mMsg ) );
 }
 
 void EncoderUpdateMsg::sendOut( SerialLink& link )
@@ -1107,7 +1529,8 @@ void EncoderUpdateMsg::sendOut( SerialLink& link )
     mContent.sendOut( link );
 
     debugCond2cout<kDebugSerialMsgs>( "Sent EncoderUpdateMsg", std::get<0>( mContent.mMsg ),
-                                      std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ) );
+                                      std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ),
+                                      std::get<3>( mContent.mMsg ), std::get<4>( mContent.mMsg ) );
 }
 
 void EncoderUpdateMsg::takeAction( EventManager&, SerialLink& link )
@@ -1145,9 +1568,9 @@ EncoderUpdateControlMsg::EncoderUpdateControlMsg( MsgId id )
 {
     if ( id != MsgId::kEncoderUpdateControl )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kEncoderUpdateControl ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kEncoderUpdateControl ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -1204,9 +1627,9 @@ BatteryLevelRequestMsg::BatteryLevelRequestMsg( MsgId id )
 {
     if ( id != MsgId::kBatteryLevelRequest )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kBatteryLevelRequest ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kBatteryLevelRequest ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -1236,15 +1659,15 @@ void BatteryLevelRequestMsg::takeAction( EventManager& events, SerialLink& link
         if ( whichBattery == std::to_underlying( Battery::kIcBattery )
              || whichBattery == std::to_underlying( Battery::kBothBatteries ) )
         {
-            float volts = Batteries::getIcBatteryVoltage();
-            BatteryLevelUpdateMsg msg( Battery::kIcBattery, volts );
+            std::uint16_t raw = Batteries::getIcBatteryRaw();
+            BatteryLevelUpdateMsg msg( Battery::kIcBattery, raw );
             msg.sendOut( link );
         }
         else if ( whichBattery == std::to_underlying( Battery::kMotorBattery )
                   || whichBattery == std::to_underlying( Battery::kBothBatteries ) )
         {
-            float volts = Batteries::getMotorBatteryVoltage();
-            BatteryLevelUpdateMsg msg( Battery::kMotorBattery, volts );
+            std::uint16_t raw = Batteries::getMotorBatteryRaw();
+            BatteryLevelUpdateMsg msg( Battery::kMotorBattery, raw );
             msg.sendOut( link );
         }
         else
@@ -1274,10 +1697,11 @@ BatteryLevelUpdateMsg::BatteryLevelUpdateMsg( TheData t ) noexcept
       mNeedsAction{ true }
 {}
 
-BatteryLevelUpdateMsg::BatteryLevelUpdateMsg( Battery whichBattery, float level ) noexcept
+BatteryLevelUpdateMsg::BatteryLevelUpdateMsg( Battery whichBattery,
+                                              std::uint16_t rawCounts ) noexcept
     : SerialMessage( MsgId::kBatteryLevelUpdate ),
       mContent( MsgId::kBatteryLevelUpdate,
-                std::make_tuple( std::to_underlying( whichBattery ), level ) ),
+                std::make_tuple( std::to_underlying( whichBattery ), rawCounts ) ),
       mNeedsAction{ true }
 {}
 
@@ -1286,9 +1710,9 @@ BatteryLevelUpdateMsg::BatteryLevelUpdateMsg( MsgId id )
 {
     if ( id != MsgId::kBatteryLevelUpdate )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kBatteryLevelUpdate ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kBatteryLevelUpdate ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -1323,6 +1747,191 @@ void BatteryLevelUpdateMsg::takeAction( EventManager&, SerialLink& link )
 
 /******************************************************************************/
 
+EventStatsRequestMsg::EventStatsRequestMsg() noexcept
+    : SerialMessage( MsgId::kEventStatsRequest ),
+      mContent( MsgId::kEventStatsRequest ),
+      mNeedsAction{ false }
+{}
+
+EventStatsRequestMsg::EventStatsRequestMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kEventStatsRequest ),
+      mContent( MsgId::kEventStatsRequest, t ),
+      mNeedsAction{ true }
+{}
+
+EventStatsRequestMsg::EventStatsRequestMsg( bool resetAfter ) noexcept
+    : SerialMessage( MsgId::kEventStatsRequest ),
+      mContent( MsgId::kEventStatsRequest,
+                std::make_tuple( static_cast<std::uint8_t>( resetAfter ) ) ),
+      mNeedsAction{ true }
+{}
+
+EventStatsRequestMsg::EventStatsRequestMsg( MsgId id )
+    : SerialMessage( id ), mContent( MsgId::kEventStatsRequest ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kEventStatsRequest )
+    {
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kEventStatsRequest ) ),
+                         "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void EventStatsRequestMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "Got EventStatsRequestMsg",
+                                      static_cast<int>( std::get<0>( mContent.mMsg ) ) );
+}
+
+void EventStatsRequestMsg::sendOut( SerialLink& link )
+{
+    // This never sent from Pico
+}
+
+void EventStatsRequestMsg::takeAction( EventManager& events, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        EventStats::sendAll( link );
+
+        if ( std::get<0>( mContent.mMsg ) )
+        {
+            EventStats::reset();
+        }
+
+        mNeedsAction = false;
+    }
+}
+
+/******************************************************************************/
+
+EventStatsMsg::EventStatsMsg() noexcept
+    : SerialMessage( MsgId::kEventStats ), mContent( MsgId::kEventStats ), mNeedsAction{ false }
+{}
+
+EventStatsMsg::EventStatsMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kEventStats ),
+      mContent( MsgId::kEventStats, t ),
+      mNeedsAction{ true }
+{}
+
+EventStatsMsg::EventStatsMsg( std::uint8_t evtId, EventStatsKind kind, std::uint32_t maxUs,
+                              const EventStatsCounts& counts ) noexcept
+    : SerialMessage( MsgId::kEventStats ),
+      mContent( MsgId::kEventStats,
+                std::tuple_cat( std::make_tuple( evtId, std::to_underlying( kind ), maxUs ),
+                                counts ) ),
+      mNeedsAction{ true }
+{}
+
+EventStatsMsg::EventStatsMsg( MsgId id )
+    : SerialMessage( id ), mContent( MsgId::kEventStats ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kEventStats )
+    {
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kEventStats ) ),
+                         "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void EventStatsMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = false;
+
+    output2cout( "Error: got EventStatsMsg", getIdNum(),
+                 static_cast<int>( std::get<0>( mContent.mMsg ) ) );
+}
+
+void EventStatsMsg::sendOut( SerialLink& link )
+{
+    mContent.sendOut( link );
+
+    debugCond2cout<kDebugSerialMsgs>( "Sent EventStatsMsg", getIdNum(),
+                                      static_cast<int>( std::get<0>( mContent.mMsg ) ),
+                                      static_cast<int>( std::get<1>( mContent.mMsg ) ),
+                                      std::get<2>( mContent.mMsg ) );
+}
+
+void EventStatsMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        // This message should only be sent, not received
+        output2cout( "Error: Trying to takeAction() on local Msg", getIdNum() );
+        mNeedsAction = false;
+    }
+}
+
+/******************************************************************************/
+
+MemoryStatsMsg::MemoryStatsMsg() noexcept
+    : SerialMessage( MsgId::kMemoryStats ), mContent( MsgId::kMemoryStats ), mNeedsAction{ false }
+{}
+
+MemoryStatsMsg::MemoryStatsMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kMemoryStats ),
+      mContent( MsgId::kMemoryStats, t ),
+      mNeedsAction{ true }
+{}
+
+MemoryStatsMsg::MemoryStatsMsg( std::uint32_t heapUsed, std::uint32_t heapHighWater,
+                                std::uint32_t heapFree, std::uint16_t core0StackFree,
+                                std::uint16_t core1StackFree, std::uint32_t time ) noexcept
+    : SerialMessage( MsgId::kMemoryStats ),
+      mContent( MsgId::kMemoryStats, std::make_tuple( heapUsed, heapHighWater, heapFree,
+                                                      core0StackFree, core1StackFree, time ) ),
+      mNeedsAction{ true }
+{}
+
+MemoryStatsMsg::MemoryStatsMsg( MsgId id )
+    : SerialMessage( id ), mContent( MsgId::kMemoryStats ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kMemoryStats )
+    {
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kMemoryStats ) ),
+                         "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void MemoryStatsMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = false;
+
+    output2cout( "Error: got MemoryStatsMsg", getIdNum() );
+}
+
+void MemoryStatsMsg::sendOut( SerialLink& link )
+{
+    mContent.sendOut( link );
+
+    debugCond2cout<kDebugSerialMsgs>( "Sent MemoryStatsMsg", getIdNum(),
+                                      std::get<0>( mContent.mMsg ), std::get<1>( mContent.mMsg ),
+                                      std::get<2>( mContent.mMsg ), std::get<3>( mContent.mMsg ),
+                                      std::get<4>( mContent.mMsg ) );
+}
+
+void MemoryStatsMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        // This message should only be sent, not received
+        output2cout( "Error: Trying to takeAction() on local Msg", getIdNum() );
+        mNeedsAction = false;
+    }
+}
+
+/******************************************************************************/
+
 ErrorReportMsg::ErrorReportMsg() noexcept
     : SerialMessage( MsgId::kErrorReportFromPico ),
       mContent( MsgId::kErrorReportFromPico ),
@@ -1347,9 +1956,9 @@ ErrorReportMsg::ErrorReportMsg( MsgId id )
 {
     if ( id != MsgId::kErrorReportFromPico )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kErrorReportFromPico ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kErrorReportFromPico ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -1409,9 +2018,9 @@ TestPicoErrorRptMsg::TestPicoErrorRptMsg( MsgId id )
 {
     if ( id != MsgId::kTestPicoReportError )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kTestPicoReportError ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kTestPicoReportError ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -1478,9 +2087,9 @@ TestPicoMessagesMsg::TestPicoMessagesMsg( MsgId id )
 {
     if ( id != MsgId::kTestPicoMessages )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kTestPicoMessages ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kTestPicoMessages ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -1576,6 +2185,13 @@ void TestPicoMessagesMsg::takeAction( EventManager& evt, SerialLink& link )
             };
             break;
 
+            case MsgId::kResetPicoConfig:
+            {
+                ResetPicoConfigMsg msg;
+                msg.sendOut( link );
+            };
+            break;
+
             case MsgId::kTimerEventMsg:
             {
                 TimerEventMsg msg( TimerEventMsg::k1SecondEvent, 123, 123'456 );
@@ -1590,23 +2206,62 @@ void TestPicoMessagesMsg::takeAction( EventManager& evt, SerialLink& link )
             };
             break;
 
+            case MsgId::kCalibrationProfile:
+            {
+                CalibrationProfileMsg msg(
+                    CalibrationProfileMsg::Profile{ -12, 5, -20, 310, -95, 402, -1, 0, 2, 1000, 726 } );
+                msg.sendOut( link );
+            };
+            break;
+
             case MsgId::kTimerNavUpdate:
             {
-                NavUpdateMsg msg( 180.081f, 456'123 );
+                NavUpdateMsg msg( 2881, 456'123 );
+                msg.sendOut( link );
+            };
+            break;
+
+            case MsgId::kExtendedNavUpdate:
+            {
+                ExtendedNavUpdateMsg msg( { 2881, -40, 96 }, { 3, -1, 160 }, { 12, -7, 981 },
+                                          0xFF, 456'123 );
+                msg.sendOut( link );
+            };
+            break;
+
+            case MsgId::kPoseUpdate:
+            {
+                PoseUpdateMsg msg( 256'000, -12'800, 2881, 456'123 );
                 msg.sendOut( link );
             };
             break;
 
             case MsgId::kEncoderUpdate:
             {
-                EncoderUpdateMsg msg( EncoderUpdateMsg::Side::kRight, -10, 654'321 );
+                EncoderUpdateMsg msg( 160, 176, 1'234, 1'240, 654'321 );
                 msg.sendOut( link );
             };
             break;
 
             case MsgId::kBatteryLevelUpdate:
             {
-                BatteryLevelUpdateMsg msg( Battery::kBothBatteries, 5.2f );
+                BatteryLevelUpdateMsg msg( Battery::kBothBatteries, 2'700 );
+                msg.sendOut( link );
+            };
+            break;
+
+            case MsgId::kEventStats:
+            {
+                EventStatsMsg msg( std::to_underlying( EvtId::kNavUpdateEvent ),
+                                   EventStatsKind::kExecutionTime, 70'000,
+                                   EventStatsCounts{ 1, 2, 3, 4, 5, 6, 7, 8 } );
+                msg.sendOut( link );
+            };
+            break;
+
+            case MsgId::kMemoryStats:
+            {
+                MemoryStatsMsg msg( 12'345, 16'384, 200'000, 1'024, 1'536, Clock::millis() );
                 msg.sendOut( link );
             };
             break;
@@ -1638,9 +2293,12 @@ void TestPicoMessagesMsg::takeAction( EventManager& evt, SerialLink& link )
             case MsgId::kSetAutoCalibrate:
             case MsgId::kResetBNO055:
             case MsgId::kNavUpdateControl:
+            case MsgId::kNavRateControl:
             case MsgId::kDrivingStatusUpdate:
+            case MsgId::kImpactControl:
             case MsgId::kEncoderUpdateControl:
             case MsgId::kBatteryLevelRequest:
+            case MsgId::kEventStatsRequest:
             case MsgId::kUnknownMessage:
             case MsgId::kTestPicoReportError:
             case MsgId::kTestPicoMessages:
@@ -1681,9 +2339,9 @@ PicoReceivedTestMsg::PicoReceivedTestMsg( MsgId id )
 {
     if ( id != MsgId::kPicoReceivedTestMsg )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kPicoReceivedTestMsg ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kPicoReceivedTestMsg ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
@@ -1739,9 +2397,9 @@ DebugLinkMsg::DebugLinkMsg( MsgId id )
 {
     if ( id != MsgId::kDebugSerialLink )
     {
-        throw CarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
-                                           std::to_underlying( MsgId::kDebugSerialLink ) ),
-                          "Id mismatch at creation" );
+        raiseCarrtError( makePicoErrorId( kPicoSerialMessageError, 1,
+                                          std::to_underlying( MsgId::kDebugSerialLink ) ),
+                         "Id mismatch at creation" );
     }
     // Note that it doesn't need action until loaded with data
 }
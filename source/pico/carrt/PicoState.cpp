@@ -19,39 +19,63 @@
 
 #include "PicoState.h"
 
+#include <cstdint>
+
+#include "CarrtPicoDefines.h"
+#include "ConfigStore.h"
 #include "CoreAtomic.hpp"
+#include "NavRate.h"
 
 namespace
 {
-    // These all happen in Core0 so no atomics needed
-    bool sSendQtrSecTimerMsgs{ false };
-    bool sSend1SecTimerMsgs{ false };
-    bool sSend8SecTimerMsgs{ false };
-    bool sSendNavMsgs{ false };
-    bool sSendNavStatusMsgs{ false };
-    bool sSendEncoderMsgs{ false };
-    bool sSendCalibrationMsgs{ false };
-    bool sSendBatteryMsgs{ false };
+    // Which msgs the RPi0 wants, one bit each
+    enum MsgBits : std::uint32_t
+    {
+        kQtrSecTimerMsgs = 0x0001,
+        k1SecTimerMsgs = 0x0002,
+        k8SecTimerMsgs = 0x0004,
+        kNavMsgs = 0x0008,
+        kNavStatusMsgs = 0x0010,
+        kExtendedNavMsgs = 0x0020,
+        kPoseMsgs = 0x0040,
+        kEncoderMsgs = 0x0080,
+        kCalibrationMsgs = 0x0100,
+        kBatteryMsgs = 0x0200,
+
+        kNoMsgs = 0x0000,
+        kAllMsgs = 0x03FF
+    };
 
+    // These all happen in Core0 so no atomics needed
     bool sStartUpFinished{ false };
     bool sNavCalibrated{ false };
     bool sAutoCalibrateMode{ false };
-
-    // These are shared Core0 and Core1 and require atomics
+    bool sConfigRestored{ false };
+    std::uint16_t sNavRateHz{ NavRate::kDefaultHz };
+    bool sImpactEnabled{ true };
+    std::uint16_t sImpactAccelThreshold{ CARRTPICO_IMPACT_ACCEL_THRESHOLD };
+    std::uint16_t sImpactStallMs{ CARRTPICO_IMPACT_STALL_MS };
+
+    // These are shared Core0 and Core1 and require atomics (Core1 reads
+    // the msg flags so it doesn't queue events nobody wants; a word, so
+    // reading it is lock-free)
+    CoreAtomic::CAtomic<std::uint32_t> sSendMsgs{ kNoMsgs };
     CoreAtomic::CAtomic<bool> sInCalibrationMode{ false };
+
+    bool wantMsgs( std::uint32_t bits ) noexcept { return sSendMsgs.load() & bits; }
+
+    // Returns prior value
+    bool sendMsgs( std::uint32_t bits, bool newVal ) noexcept
+    {
+        std::uint32_t oldMsgs{ newVal ? sSendMsgs.fetch_or( bits ) : sSendMsgs.fetch_and( ~bits ) };
+        return oldMsgs & bits;
+    }
 }    // namespace
 
 // clang-format off
 void PicoState::initialize() noexcept
 {
-    sSendQtrSecTimerMsgs    = false;
-    sSend1SecTimerMsgs      = false;
-    sSend8SecTimerMsgs      = false;
-    sSendNavMsgs            = false;
-    sSendNavStatusMsgs      = false;
-    sSendEncoderMsgs        = false;
-    sSendCalibrationMsgs    = false;
-    sSendBatteryMsgs        = false;
+    sSendMsgs               = kNoMsgs;
 
     sStartUpFinished        = false;
 
@@ -59,9 +83,53 @@ void PicoState::initialize() noexcept
     
     sAutoCalibrateMode      = false;
     sInCalibrationMode      = false;
+
+    sNavRateHz              = NavRate::kDefaultHz;
+    sImpactEnabled          = true;
+    sImpactAccelThreshold   = CARRTPICO_IMPACT_ACCEL_THRESHOLD;
+    sImpactStallMs          = CARRTPICO_IMPACT_STALL_MS;
+
+    PicoState::Config saved;
+    sConfigRestored         = ConfigStore::load( &saved );
+    if ( sConfigRestored )
+    {
+        PicoState::setConfig( saved );
+    }
 }
 // clang-format on
 
+bool PicoState::configRestored() noexcept { return sConfigRestored; }
+
+PicoState::Config PicoState::defaultConfig() noexcept
+{
+    return { .mSendMsgs = kAllMsgs,
+             .mAutoCalibrate = false,
+             .mNavRateHz = NavRate::kDefaultHz,
+             .mImpactEnabled = true,
+             .mImpactAccelThreshold = CARRTPICO_IMPACT_ACCEL_THRESHOLD,
+             .mImpactStallMs = CARRTPICO_IMPACT_STALL_MS };
+}
+
+PicoState::Config PicoState::getConfig() noexcept
+{
+    return { .mSendMsgs = sSendMsgs.load(),
+             .mAutoCalibrate = sAutoCalibrateMode,
+             .mNavRateHz = sNavRateHz,
+             .mImpactEnabled = sImpactEnabled,
+             .mImpactAccelThreshold = sImpactAccelThreshold,
+             .mImpactStallMs = sImpactStallMs };
+}
+
+void PicoState::setConfig( const Config& config ) noexcept
+{
+    sSendMsgs = config.mSendMsgs & kAllMsgs;
+    sAutoCalibrateMode = config.mAutoCalibrate;
+    sNavRateHz = config.mNavRateHz;
+    sImpactEnabled = config.mImpactEnabled;
+    sImpactAccelThreshold = config.mImpactAccelThreshold;
+    sImpactStallMs = config.mImpactStallMs;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 bool PicoState::startUpFinished( bool newVal ) noexcept
@@ -75,110 +143,82 @@ bool PicoState::startUpFinished() noexcept { return sStartUpFinished; }
 
 void PicoState::sendAllTimerMsgs( bool newVal ) noexcept
 {
-    sSendQtrSecTimerMsgs = newVal;
-    sSend1SecTimerMsgs = newVal;
-    sSend8SecTimerMsgs = newVal;
+    sendMsgs( kQtrSecTimerMsgs | k1SecTimerMsgs | k8SecTimerMsgs, newVal );
 }
 
 bool PicoState::sendQtrSecTimerMsgs( bool newVal ) noexcept
 {
-    bool oldVal = sSendQtrSecTimerMsgs;
-    sSendQtrSecTimerMsgs = newVal;
-    return oldVal;
+    return sendMsgs( kQtrSecTimerMsgs, newVal );
 }
 
-bool PicoState::wantQtrSecTimerMsgs() noexcept { return sSendQtrSecTimerMsgs; }
+bool PicoState::wantQtrSecTimerMsgs() noexcept { return wantMsgs( kQtrSecTimerMsgs ); }
 
 bool PicoState::send1SecTimerMsgs( bool newVal ) noexcept
 {
-    bool oldVal = sSend1SecTimerMsgs;
-    sSend1SecTimerMsgs = newVal;
-    return oldVal;
+    return sendMsgs( k1SecTimerMsgs, newVal );
 }
 
-bool PicoState::want1SecTimerMsgs() noexcept { return sSend1SecTimerMsgs; }
+bool PicoState::want1SecTimerMsgs() noexcept { return wantMsgs( k1SecTimerMsgs ); }
 
 bool PicoState::send8SecTimerMsgs( bool newVal ) noexcept
 {
-    bool oldVal = sSend8SecTimerMsgs;
-    sSend8SecTimerMsgs = newVal;
-    return oldVal;
+    return sendMsgs( k8SecTimerMsgs, newVal );
 }
 
-bool PicoState::want8SecTimerMsgs() noexcept { return sSend8SecTimerMsgs; }
+bool PicoState::want8SecTimerMsgs() noexcept { return wantMsgs( k8SecTimerMsgs ); }
 
 bool PicoState::sendNavMsgs( bool newVal ) noexcept
 {
-    bool oldVal = sSendNavMsgs;
-    sSendNavMsgs = newVal;
-    return oldVal;
+    return sendMsgs( kNavMsgs, newVal );
 }
 
-bool PicoState::wantNavMsgs() noexcept { return sSendNavMsgs; }
+bool PicoState::wantNavMsgs() noexcept { return wantMsgs( kNavMsgs ); }
 
 bool PicoState::sendNavStatusMsgs( bool newVal ) noexcept
 {
-    bool oldVal = sSendNavStatusMsgs;
-    sSendNavStatusMsgs = newVal;
-    return oldVal;
+    return sendMsgs( kNavStatusMsgs, newVal );
 }
 
-bool PicoState::wantNavStatusMsgs() noexcept { return sSendNavStatusMsgs; }
+bool PicoState::wantNavStatusMsgs() noexcept { return wantMsgs( kNavStatusMsgs ); }
 
-bool PicoState::sendEncoderMsgs( bool newVal ) noexcept
+bool PicoState::sendExtendedNavMsgs( bool newVal ) noexcept
 {
-    bool oldVal = sSendEncoderMsgs;
-    sSendEncoderMsgs = newVal;
-    return oldVal;
+    return sendMsgs( kExtendedNavMsgs, newVal );
 }
 
-bool PicoState::wantEncoderMsgs() noexcept { return sSendEncoderMsgs; }
+bool PicoState::wantExtendedNavMsgs() noexcept { return wantMsgs( kExtendedNavMsgs ); }
 
-bool PicoState::sendCalibrationMsgs( bool newVal ) noexcept
+bool PicoState::sendPoseMsgs( bool newVal ) noexcept
 {
-    bool oldVal = sSendCalibrationMsgs;
-    sSendCalibrationMsgs = newVal;
-    return oldVal;
+    return sendMsgs( kPoseMsgs, newVal );
 }
 
-bool PicoState::wantCalibrationMsgs() noexcept { return sSendEncoderMsgs; }
+bool PicoState::wantPoseMsgs() noexcept { return wantMsgs( kPoseMsgs ); }
 
-bool PicoState::sendBatteryMsgs( bool newVal ) noexcept
+bool PicoState::sendEncoderMsgs( bool newVal ) noexcept
 {
-    bool oldVal = sSendBatteryMsgs;
-    sSendBatteryMsgs = newVal;
-    return oldVal;
+    return sendMsgs( kEncoderMsgs, newVal );
 }
 
-bool PicoState::wantBatteryMsgs() noexcept { return sSendBatteryMsgs; }
+bool PicoState::wantEncoderMsgs() noexcept { return wantMsgs( kEncoderMsgs ); }
 
-// clang-format off
-void PicoState::allMsgsSendOn() noexcept
+bool PicoState::sendCalibrationMsgs( bool newVal ) noexcept
 {
-    sSendQtrSecTimerMsgs    = true;
-    sSend1SecTimerMsgs      = true;
-    sSend8SecTimerMsgs      = true;
-    sSendNavMsgs            = true;
-    sSendNavStatusMsgs      = true;
-    sSendEncoderMsgs        = true;
-    sSendCalibrationMsgs    = true;
-    sSendBatteryMsgs        = true;
+    return sendMsgs( kCalibrationMsgs, newVal );
 }
-// clang-format on
 
-// clang-format off
-void PicoState::allMsgsSendOff() noexcept
+bool PicoState::wantCalibrationMsgs() noexcept { return wantMsgs( kCalibrationMsgs ); }
+
+bool PicoState::sendBatteryMsgs( bool newVal ) noexcept
 {
-    sSendQtrSecTimerMsgs    = false;
-    sSend1SecTimerMsgs      = false;
-    sSend8SecTimerMsgs      = false;
-    sSendNavMsgs            = false;
-    sSendNavStatusMsgs      = false;
-    sSendEncoderMsgs        = false;
-    sSendCalibrationMsgs    = false;
-    sSendBatteryMsgs        = false;
+    return sendMsgs( kBatteryMsgs, newVal );
 }
-// clang-format on
+
+bool PicoState::wantBatteryMsgs() noexcept { return wantMsgs( kBatteryMsgs ); }
+
+void PicoState::allMsgsSendOn() noexcept { sSendMsgs = kAllMsgs; }
+
+void PicoState::allMsgsSendOff() noexcept { sSendMsgs = kNoMsgs; }
 
 bool PicoState::calibrationInProgress() noexcept { return sInCalibrationMode; }
 
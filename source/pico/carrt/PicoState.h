@@ -21,16 +21,46 @@
 #ifndef PicoState_h
 #define PicoState_h
 
+#include <cstdint>
+
 namespace PicoState
 {
 
-    void initialize() noexcept;    // Initialize stuff
+    // What the RPi0 has configured (which msgs to send, auto-calibration,
+    // the nav update rate and impact detection); ConfigStore keeps this in
+    // flash so it survives a reset.  PicoState only holds the rate and
+    // impact settings: NavRate and ImpactDetector apply them (the msg
+    // handlers, start up, and ConfigStore::factoryReset() see to that).
+    struct Config
+    {
+        std::uint32_t mSendMsgs;
+        bool mAutoCalibrate;
+        std::uint16_t mNavRateHz;
+        bool mImpactEnabled;
+        std::uint16_t mImpactAccelThreshold;    // Raw BNO055 units
+        std::uint16_t mImpactStallMs;
+
+        bool operator==( const Config& ) const = default;
+    };
+
+    // Initialize stuff, restoring the saved Config (if any) from flash
+    void initialize() noexcept;
+
+    // Did initialize() find a saved Config?
+    bool configRestored() noexcept;
+
+    Config defaultConfig() noexcept;    // What a Pico with nothing saved uses
+    Config getConfig() noexcept;
+    void setConfig( const Config& config ) noexcept;
 
     // Have we finished start up of Pico
     // Everything through BNO initialized, but not necessarily calibrated)
     bool startUpFinished() noexcept;                 // Returns value
     bool startUpFinished( bool newval ) noexcept;    // Returns prior value
 
+    // The msg flags below are shared with Core1 (so it can skip queuing
+    // events for msgs nobody wants) and are safe to use from either core
+
     // Sets all three Timer msgs to "send" at once
     void sendAllTimerMsgs( bool newVal ) noexcept;
 
@@ -49,6 +79,12 @@ namespace PicoState
     bool wantNavStatusMsgs() noexcept;                 // Returns value
     bool sendNavStatusMsgs( bool newVal ) noexcept;    // Returns prior value
 
+    bool wantExtendedNavMsgs() noexcept;                 // Returns value
+    bool sendExtendedNavMsgs( bool newVal ) noexcept;    // Returns prior value
+
+    bool wantPoseMsgs() noexcept;                 // Returns value
+    bool sendPoseMsgs( bool newVal ) noexcept;    // Returns prior value
+
     bool wantEncoderMsgs() noexcept;                 // Returns value
     bool sendEncoderMsgs( bool newVal ) noexcept;    // Returns prior value
 
@@ -0,0 +1,162 @@
+/*
+    PoseEstimator.cpp - Dead reckoning of CARRT's position for CARRT-Pico
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PoseEstimator.h"
+
+#include <array>
+#include <cstdint>
+
+#include "TelemetryUnits.h"
+
+namespace
+{
+    constexpr int kRawPerDegree{ TelemetryUnits::kRawAngleLsbPerDegree };
+    constexpr int kRawQuarterTurn{ 90 * kRawPerDegree };
+    constexpr int kRawHalfTurn{ 2 * kRawQuarterTurn };
+    constexpr int kRawFullTurn{ 4 * kRawQuarterTurn };
+
+    // Trig results are Q14: 1.0 = 16384
+    constexpr int kTrigShift{ 14 };
+
+    // sin() for whole degrees 0-90 in Q14
+    constexpr std::array<std::int16_t, 91> kSinTable{
+        0,     286,   572,   857,   1143,  1428,  1713,  1997,  2280,  2563,  2845,  3126,  3406,
+        3686,  3964,  4240,  4516,  4790,  5063,  5334,  5604,  5872,  6138,  6402,  6664,  6924,
+        7182,  7438,  7692,  7943,  8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860,  10087,
+        10311, 10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365, 12551, 12733,
+        12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044, 14189, 14330, 14466, 14598, 14726,
+        14849, 14968, 15082, 15191, 15296, 15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964,
+        16026, 16083, 16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382, 16384
+    };
+
+    // Only used on Core0
+    std::int32_t sX{ 0 };
+    std::int32_t sY{ 0 };
+    std::int16_t sHeading{ 0 };
+    bool sHaveHeading{ false };
+
+    int sLeftDirection{ 1 };
+    int sRightDirection{ 1 };
+    std::uint32_t sLastLeftDistance{ 0 };
+    std::uint32_t sLastRightDistance{ 0 };
+    std::int32_t sPendingLeft{ 0 };
+    std::int32_t sPendingRight{ 0 };
+
+    int normalize( int rawAngle )
+    {
+        rawAngle %= kRawFullTurn;
+        return rawAngle < 0 ? rawAngle + kRawFullTurn : rawAngle;
+    }
+
+    // First quadrant: interpolate between whole degrees
+    int sinFirstQuadrant( int rawAngle )
+    {
+        int deg{ rawAngle / kRawPerDegree };
+        if ( deg >= 90 )
+        {
+            return kSinTable[ 90 ];
+        }
+        int frac{ rawAngle % kRawPerDegree };
+        return kSinTable[ deg ] + ( ( kSinTable[ deg + 1 ] - kSinTable[ deg ] ) * frac ) / kRawPerDegree;
+    }
+
+    int sinQ14( int rawAngle )
+    {
+        rawAngle = normalize( rawAngle );
+        int inQuadrant{ rawAngle % kRawQuarterTurn };
+
+        switch ( rawAngle / kRawQuarterTurn )
+        {
+            case 0:
+                return sinFirstQuadrant( inQuadrant );
+
+            case 1:
+                return sinFirstQuadrant( kRawQuarterTurn - inQuadrant );
+
+            case 2:
+                return -sinFirstQuadrant( inQuadrant );
+
+            default:
+                return -sinFirstQuadrant( kRawQuarterTurn - inQuadrant );
+        }
+    }
+
+    int cosQ14( int rawAngle ) { return sinQ14( rawAngle + kRawQuarterTurn ); }
+
+    // Mean of two headings, taking the short way around
+    int meanHeading( int from, int to )
+    {
+        int diff{ normalize( to - from + kRawHalfTurn ) - kRawHalfTurn };
+        return normalize( from + diff / 2 );
+    }
+
+    void integrate( int heading )
+    {
+        // Center of the axle moves the mean of the two wheels
+        std::int64_t distance{ static_cast<std::int64_t>( sPendingLeft + sPendingRight )
+                               * TelemetryUnits::kRawPositionLsbPerEdge / 2 };
+        sPendingLeft = 0;
+        sPendingRight = 0;
+
+        sX += static_cast<std::int32_t>( ( distance * cosQ14( heading ) ) >> kTrigShift );
+        sY += static_cast<std::int32_t>( ( distance * sinQ14( heading ) ) >> kTrigShift );
+    }
+
+    PoseEstimator::Pose currentPose()
+    {
+        return PoseEstimator::Pose{ .x = sX, .y = sY, .heading = sHeading };
+    }
+
+}    // namespace
+
+void PoseEstimator::setWheelDirections( int left, int right ) noexcept
+{
+    sLeftDirection = left;
+    sRightDirection = right;
+}
+
+void PoseEstimator::addTravel( const Odometry::Wheels& wheels ) noexcept
+{
+    // Distances are running totals; unsigned subtraction handles the wrap
+    sPendingLeft += sLeftDirection
+                    * static_cast<std::int32_t>( wheels.leftDistance - sLastLeftDistance );
+    sPendingRight += sRightDirection
+                     * static_cast<std::int32_t>( wheels.rightDistance - sLastRightDistance );
+    sLastLeftDistance = wheels.leftDistance;
+    sLastRightDistance = wheels.rightDistance;
+}
+
+PoseEstimator::Pose PoseEstimator::update( std::int16_t rawHeading ) noexcept
+{
+    int heading{ normalize( rawHeading ) };
+
+    integrate( sHaveHeading ? meanHeading( sHeading, heading ) : heading );
+
+    sHeading = static_cast<std::int16_t>( heading );
+    sHaveHeading = true;
+
+    return currentPose();
+}
+
+PoseEstimator::Pose PoseEstimator::update() noexcept
+{
+    integrate( sHeading );
+
+    return currentPose();
+}
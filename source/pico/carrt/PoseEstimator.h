@@ -0,0 +1,75 @@
+/*
+    PoseEstimator.h - Dead reckoning of CARRT's position for CARRT-Pico
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PoseEstimator_h
+#define PoseEstimator_h
+
+#include <cstdint>
+
+#include "Odometry.h"
+
+// Integrates the distance the wheels travel along the BNO055 heading, all
+// in integer math (no FPU on the Pico).  Position is relative to where the
+// Pico started, x north and y east (BNO055 heading is clockwise from
+// north), in raw units (see TelemetryUnits).  All of these are called
+// from Core0.
+//
+// Integration happens once per nav tick (NavRate, 8 Hz by default), not
+// per encoder sample: a tick's travel is laid along the mean of the
+// headings at its two ends.  With the heading changing by theta radians
+// over a tick (turn rate / nav rate):
+//  - a steady arc is exact in direction and overstates distance by about
+//    theta^2 / 24 (0.16% at 90 deg/s and 8 Hz);
+//  - where the turn rate changes within a tick (starting or ending a
+//    turn) the direction can be off by up to theta / 2 for that tick's
+//    travel (about 4 mm sideways at 0.3 m/s, 90 deg/s and 8 Hz);
+//  - the heading NavSampler hands over can be up to
+//    CARRTPICO_NAV_SAMPLE_MAX_AGE_US old, a further lag of turn rate times
+//    that age;
+//  - pivots (wheels turning opposite ways) add almost nothing, since the
+//    axle center barely moves.
+// Errors accumulate with distance, so the pose drifts; raising the nav
+// rate shrinks the first two (the first quadratically).  Wheel slip and
+// the encoders' resolution usually matter more than any of these.
+namespace PoseEstimator
+{
+    struct Pose
+    {
+        std::int32_t x;
+        std::int32_t y;
+        std::int16_t heading;    // Raw BNO055 units
+    };
+
+    // The encoders can't tell direction, so the RPi0 tells us (via its
+    // driving status) which way each wheel turns: +1, -1 (or 0 to ignore)
+    void setWheelDirections( int left, int right ) noexcept;
+
+    // Once per nav tick, with the latest odometry
+    void addTravel( const Odometry::Wheels& wheels ) noexcept;
+
+    // Move the pose by the travel added since the last update, along the
+    // mean of the previous and new headings
+    Pose update( std::int16_t rawHeading ) noexcept;
+
+    // Same, but with no new heading (BNO055 not calibrated or not in use)
+    Pose update() noexcept;
+
+};    // namespace PoseEstimator
+
+#endif    // PoseEstimator_h
@@ -54,18 +54,46 @@ namespace BNO055
 {
     struct bno055_t sBno055;
 
+    std::optional<CalibrationProfile> sSavedProfile{};
+
+    constexpr int kProfileBytes{ 2 * kCalibrationProfileSize };
+
+    // Gyro data (0x14) through calibration status (0x35) are contiguous on
+    // page 0; the block also holds gravity (0x2E) and temperature (0x34),
+    // which we don't use, but skipping them would cost a second transaction
+    constexpr unsigned char kFusionFirstReg{ BNO055_GYRO_DATA_X_LSB_ADDR };
+    constexpr int kFusionBurstLen{ BNO055_CALIB_STAT_ADDR - kFusionFirstReg + 1 };
+
+    // For the interrupt-driven version of the burst read
+    unsigned char sFusionBuf[ kFusionBurstLen ];
+    I2C::Transfer sFusionRead{ .status = I2C::TransferStatus::kDone };
+
     void delayMsec( unsigned int msec );
+
+    FusionState decodeFusionState( const unsigned char* buf );
+
+    void setOperationMode( unsigned char mode );
+    void writeCalibrationProfile( const CalibrationProfile& profile );
 };    // namespace BNO055
 
 void BNO055::delayMsec( unsigned int msec ) { sleep_ms( msec ); }
 
 void BNO055::init()
+{
+    startInit();
+    sleep_ms( kWaitAfterModeChange );
+}
+
+void BNO055::startInit()
 {
     sBno055.dev_addr = BNO055_I2C_ADDR1;
     sBno055.bus_write = I2C::send;
     sBno055.bus_read = I2C::receive;
     sBno055.delay_msec = BNO055::delayMsec;
 
+    // All of it in one go
+    I2C::BusLock lock;
+
     int err = bno055_init( &sBno055 );    // No delay calls
 
     // Set the power mode as NORMAL
@@ -76,17 +104,23 @@ void BNO055::init()
     err += bno055_set_axis_remap_value( BNO055_REMAP_X_Y );    // No delay calls
     err += bno055_set_remap_z_sign( 1 );                       // No delay calls
 
-    // Set mode of the BNO055 to NDOF (9 Degs of Freedom, Fused)
-    // Big delay calls in next function (totalling 600ms)
-    err += bno055_set_operation_mode( BNO055_OPERATION_MODE_NDOF );
+    // Still in CONFIG mode after reset, so restore any saved calibration
+    if ( sSavedProfile )
+    {
+        writeCalibrationProfile( *sSavedProfile );
+    }
 
     if ( err )
     {
-        throw CarrtError(
+        raiseCarrtError(
             makePicoErrorId( PicoError::kPicoI2cBNO055Error, 1, err ),
             "CARRT Pico BNO055 init failed" );
     }
 
+    // Set mode of the BNO055 to NDOF (9 Degs of Freedom, Fused), leaving
+    // the wait for the mode change to the caller
+    setOperationMode( BNO055_OPERATION_MODE_NDOF );
+
     // Need to calibrate the BNO055, but that will be a separate function
 }
 
@@ -97,7 +131,7 @@ float BNO055::getHeading()
 
     if ( err )
     {
-        throw CarrtError(
+        raiseCarrtError(
             makePicoErrorId( PicoError::kPicoI2cBNO055Error, 2, err ),
             "CARRT Pico BNO055 failed to get cheading" );
     }
@@ -105,6 +139,88 @@ float BNO055::getHeading()
     return heading;
 }
 
+bool BNO055::submitFusionStateRead( EvtId doneEvent, int doneParam ) noexcept
+{
+    if ( fusionStateReadPending() )
+    {
+        return false;
+    }
+
+    sFusionRead = I2C::Transfer{ .address = sBno055.dev_addr,
+                                 .reg = kFusionFirstReg,
+                                 .data = sFusionBuf,
+                                 .len = kFusionBurstLen,
+                                 .isRead = true,
+                                 .doneEvent = doneEvent,
+                                 .doneParam = doneParam };
+
+    if ( !I2C::submit( &sFusionRead ) )
+    {
+        sFusionRead.status = I2C::TransferStatus::kFailed;
+        return false;
+    }
+
+    return true;
+}
+
+bool BNO055::fusionStateReadPending() noexcept
+{
+    return sFusionRead.status == I2C::TransferStatus::kQueued
+           || sFusionRead.status == I2C::TransferStatus::kInProgress;
+}
+
+bool BNO055::tryFinishFusionStateRead( FusionState* state ) noexcept
+{
+    if ( sFusionRead.status != I2C::TransferStatus::kDone )
+    {
+        return false;
+    }
+
+    *state = decodeFusionState( sFusionBuf );
+    return true;
+}
+
+BNO055::FusionState BNO055::decodeFusionState( const unsigned char* buf )
+{
+    constexpr int kGyroOffset{ BNO055_GYRO_DATA_X_LSB_ADDR - kFusionFirstReg };
+    constexpr int kEulerOffset{ BNO055_EULER_H_LSB_ADDR - kFusionFirstReg };
+    constexpr int kQuatOffset{ BNO055_QUATERNION_DATA_W_LSB_ADDR
+                               - kFusionFirstReg };
+    constexpr int kLinAccelOffset{ BNO055_LINEAR_ACCEL_DATA_X_LSB_ADDR
+                                   - kFusionFirstReg };
+    constexpr int kCalibOffset{ BNO055_CALIB_STAT_ADDR - kFusionFirstReg };
+
+    // Registers are little-endian LSB/MSB pairs
+    auto int16At = [buf]( int offset )
+    {
+        return static_cast<std::int16_t>( buf[ offset ]
+                                          | ( buf[ offset + 1 ] << 8 ) );
+    };
+
+    // CALIB_STAT packs S-G-A-M into bit pairs 7-6, 5-4, 3-2, 1-0
+    unsigned char calib{ buf[ kCalibOffset ] };
+
+    return FusionState{
+        .gyroX = int16At( kGyroOffset ),
+        .gyroY = int16At( kGyroOffset + 2 ),
+        .gyroZ = int16At( kGyroOffset + 4 ),
+        .heading = int16At( kEulerOffset ),
+        .roll = int16At( kEulerOffset + 2 ),
+        .pitch = int16At( kEulerOffset + 4 ),
+        .quatW = int16At( kQuatOffset ),
+        .quatX = int16At( kQuatOffset + 2 ),
+        .quatY = int16At( kQuatOffset + 4 ),
+        .quatZ = int16At( kQuatOffset + 6 ),
+        .linAccelX = int16At( kLinAccelOffset ),
+        .linAccelY = int16At( kLinAccelOffset + 2 ),
+        .linAccelZ = int16At( kLinAccelOffset + 4 ),
+        .calibration
+        = Calibration{ .mag = static_cast<unsigned char>( calib & 0x03 ),
+                       .accel = static_cast<unsigned char>( ( calib >> 2 ) & 0x03 ),
+                       .gyro = static_cast<unsigned char>( ( calib >> 4 ) & 0x03 ),
+                       .system = static_cast<unsigned char>( ( calib >> 6 ) & 0x03 ) } };
+}
+
 std::uint8_t BNO055::getMagCalibration()
 {
     unsigned char calib{};
@@ -112,7 +228,7 @@ std::uint8_t BNO055::getMagCalibration()
 
     if ( err )
     {
-        throw CarrtError(
+        raiseCarrtError(
             makePicoErrorId( PicoError::kPicoI2cBNO055Error, 3, err ),
             "CARRT Pico BNO055 failed to get cheading" );
     }
@@ -127,7 +243,7 @@ std::uint8_t BNO055::getAccelCalibration()
 
     if ( err )
     {
-        throw CarrtError(
+        raiseCarrtError(
             makePicoErrorId( PicoError::kPicoI2cBNO055Error, 4, err ),
             "CARRT Pico BNO055 failed to get cheading" );
     }
@@ -142,7 +258,7 @@ std::uint8_t BNO055::getGyroCalibration()
 
     if ( err )
     {
-        throw CarrtError(
+        raiseCarrtError(
             makePicoErrorId( PicoError::kPicoI2cBNO055Error, 5, err ),
             "CARRT Pico BNO055 failed to get cheading" );
     }
@@ -157,7 +273,7 @@ std::uint8_t BNO055::getSysCalibration()
 
     if ( err )
     {
-        throw CarrtError(
+        raiseCarrtError(
             makePicoErrorId( PicoError::kPicoI2cBNO055Error, 6, err ),
             "CARRT Pico BNO055 failed to get cheading" );
     }
@@ -174,7 +290,7 @@ int BNO055::getCalibration( unsigned char* gyro, unsigned char* accel,
 
     if ( err )
     {
-        throw CarrtError(
+        raiseCarrtError(
             makePicoErrorId( PicoError::kPicoI2cBNO055Error, 7, err ),
             "CARRT Pico BNO055 failed to get calibration" );
     }
@@ -193,7 +309,7 @@ BNO055::Calibration BNO055::getCalibration()
 
     if ( err )
     {
-        throw CarrtError(
+        raiseCarrtError(
             makePicoErrorId( PicoError::kPicoI2cBNO055Error, 8, err ),
             "CARRT Pico BNO055 failed to get calibration" );
     }
@@ -202,13 +318,90 @@ BNO055::Calibration BNO055::getCalibration()
         .mag = mag, .accel = accel, .gyro = gyro, .system = system };
 }
 
+void BNO055::startCalibrationProfileRead()
+{
+    setOperationMode( BNO055_OPERATION_MODE_CONFIG );
+}
+
+BNO055::CalibrationProfile BNO055::finishCalibrationProfileRead()
+{
+    unsigned char buf[ kProfileBytes ];
+    std::int8_t err{ I2C::receive( sBno055.dev_addr,
+                                   BNO055_ACCEL_OFFSET_X_LSB_ADDR, buf,
+                                   kProfileBytes ) };
+
+    // Go back to fusion even if the read failed
+    setOperationMode( BNO055_OPERATION_MODE_NDOF );
+
+    if ( err )
+    {
+        raiseCarrtError(
+            makePicoErrorId( PicoError::kPicoI2cBNO055Error, 11, err ),
+            "CARRT Pico BNO055 failed to get calibration profile" );
+    }
+
+    CalibrationProfile profile;
+    for ( int i = 0; i < kCalibrationProfileSize; ++i )
+    {
+        profile[ i ] = static_cast<std::int16_t>( buf[ 2 * i ]
+                                                  | ( buf[ 2 * i + 1 ] << 8 ) );
+    }
+
+    return profile;
+}
+
+void BNO055::saveCalibrationProfile( const CalibrationProfile& profile )
+{
+    sSavedProfile = profile;
+}
+
+bool BNO055::haveSavedCalibrationProfile()
+{
+    return sSavedProfile.has_value();
+}
+
+void BNO055::setOperationMode( unsigned char mode )
+{
+    // Write OPR_MODE directly: the Bosch driver's version waits 600ms
+    std::int8_t err{ I2C::send( sBno055.dev_addr, BNO055_OPR_MODE_ADDR, &mode,
+                                1 ) };
+
+    if ( err )
+    {
+        raiseCarrtError(
+            makePicoErrorId( PicoError::kPicoI2cBNO055Error, 12, err ),
+            "CARRT Pico BNO055 failed to set operation mode" );
+    }
+}
+
+void BNO055::writeCalibrationProfile( const CalibrationProfile& profile )
+{
+    unsigned char buf[ kProfileBytes ];
+    for ( int i = 0; i < kCalibrationProfileSize; ++i )
+    {
+        buf[ 2 * i ] = static_cast<unsigned char>( profile[ i ] & 0xFF );
+        buf[ 2 * i + 1 ] = static_cast<unsigned char>( ( profile[ i ] >> 8 ) & 0xFF );
+    }
+
+    std::int8_t err{ I2C::send( sBno055.dev_addr,
+                                BNO055_ACCEL_OFFSET_X_LSB_ADDR, buf,
+                                kProfileBytes ) };
+
+    if ( err )
+    {
+        raiseCarrtError(
+            makePicoErrorId( PicoError::kPicoI2cBNO055Error, 13, err ),
+            "CARRT Pico BNO055 failed to restore calibration profile" );
+    }
+}
+
 void BNO055::reset()
 {
     int err = bno055_set_sys_rst( BNO055_BIT_ENABLE );
 
     if ( err )
     {
-        throw CarrtError(
+        raiseCarrtError(
             makePicoErrorId( PicoError::kPicoI2cBNO055Error, 9, err ),
             "CARRT Pico BNO055 init failed" );
     }
@@ -20,16 +20,20 @@
 #ifndef BNO055_h
 #define BNO055_h
 
+#include <array>
 #include <cstdint>
 #include <optional>
 #include <tuple>
 
+#include "Event.h"
+
 /*
     Wait from power-on or soft reset to any I2C comms
     (e.g., initializing BNO055):  650ms
 
     Wait after mode switch (e.g., from CONFIGMODE to NDOF ):
-    600ms (according to notes in bno055.c driver and INCLUDED IN DRIVER CODE)
+    600ms (according to notes in bno055.c driver; included in init() but
+    left to the caller by startInit())
 */
 
 /*
@@ -74,6 +78,9 @@ namespace BNO055
 
     constexpr int kWaitAfterPowerOnReset{ 650 };     // milliseconds
     constexpr int kWaitAfterModeChange( 600 );       // milliseconds
+    // Mode switch times from the BNO055 datasheet (table 3-6), rounded up
+    constexpr int kWaitToConfigMode{ 20 };      // milliseconds
+    constexpr int kWaitFromConfigMode{ 10 };    // milliseconds
     constexpr std::uint8_t kCalibrationHigh{ 3 };    // 3 = High; 0 = Unreliable
 
     struct Calibration    // Always listed in order M-A-G-S
@@ -97,14 +104,64 @@ namespace BNO055
                && ( status.gyro == kCalibrationHigh ) && status.system;
     }
 
+    // Same layout as the BNO055's CALIB_STAT register (S-G-A-M, 2 bits each)
+    inline std::uint8_t packCalibration( const Calibration& status )
+    {
+        return static_cast<std::uint8_t>(
+            ( ( status.system & 0x03 ) << 6 ) | ( ( status.gyro & 0x03 ) << 4 )
+            | ( ( status.accel & 0x03 ) << 2 ) | ( status.mag & 0x03 ) );
+    }
+
+    // Raw register values, in the BNO055's own (default) units; see
+    // TelemetryUnits for the scale factors
+    struct FusionState
+    {
+        std::int16_t gyroX;         // 16 LSB = 1 deg/s
+        std::int16_t gyroY;
+        std::int16_t gyroZ;
+        std::int16_t heading;       // 16 LSB = 1 degree
+        std::int16_t roll;
+        std::int16_t pitch;
+        std::int16_t quatW;         // 2^14 LSB = 1 (unit quaternion)
+        std::int16_t quatX;
+        std::int16_t quatY;
+        std::int16_t quatZ;
+        std::int16_t linAccelX;     // 100 LSB = 1 m/s^2
+        std::int16_t linAccelY;
+        std::int16_t linAccelZ;
+        Calibration calibration;
+    };
+
+    struct LinearAccel
+    {
+        std::int16_t x;    // 100 LSB = 1 m/s^2
+        std::int16_t y;
+        std::int16_t z;
+    };
+
     // May include long delays of 600ms due to internal mode switches
     void init();
 
+    // Same as init(), but returns as soon as NDOF mode is requested; wait
+    // kWaitAfterModeChange before using the BNO055
+    void startInit();
+
     // Requires kWaitAfterPowerOnReset before then calling init()
     void reset();
 
     float getHeading();
 
+    // Gyro, Euler, quaternion, linear accel, and calibration status in a
+    // single interrupt-driven I2C burst read (for Core1, which samples the
+    // BNO055 for NavSampler).  doneEvent (with doneParam) is queued when
+    // the read ends (kNullEvent just does a __sev()).  submit...() returns
+    // false if the previous read is still in progress or the transfer
+    // can't be queued; tryFinish...() if the read failed (or hasn't
+    // finished).
+    bool submitFusionStateRead( EvtId doneEvent, int doneParam ) noexcept;
+    bool fusionStateReadPending() noexcept;
+    bool tryFinishFusionStateRead( FusionState* state ) noexcept;
+
     std::uint8_t getMagCalibration();
     std::uint8_t getAccelCalibration();
     std::uint8_t getGyroCalibration();
@@ -115,6 +172,25 @@ namespace BNO055
 
     Calibration getCalibration();
 
+    // Sensor offsets and radii (registers 0x55-0x6A) in register order:
+    // accel x-y-z, mag x-y-z, gyro x-y-z offsets, accel radius, mag radius
+    constexpr int kCalibrationProfileSize{ 11 };
+    using CalibrationProfile = std::array<std::int16_t, kCalibrationProfileSize>;
+
+    // The profile can only be read in CONFIG mode, so reading it is split
+    // in two around the mode switch (neither call waits on it): start...()
+    // drops to CONFIG mode, then finish...() (at least kWaitToConfigMode
+    // later) reads the profile and goes back to NDOF, with fusion data
+    // valid again kWaitFromConfigMode after that.  Stop Core1's nav
+    // sampling for the duration; fusion pauses meanwhile.
+    void startCalibrationProfileRead();
+    CalibrationProfile finishCalibrationProfileRead();
+
+    // Profile to write back into the BNO055 by every later init(); lets a
+    // restart skip the (slow) manual calibration
+    void saveCalibrationProfile( const CalibrationProfile& profile );
+    bool haveSavedCalibrationProfile();
+
 };    // namespace BNO055
 
 #endif    // BNO055_h
@@ -30,23 +30,90 @@
 #include "Batteries.h"
 
 #include <hardware/adc.h>
+#include <hardware/clocks.h>
+#include <hardware/dma.h>
 #include <hardware/gpio.h>
+#include <hardware/irq.h>
 #include <pico/stdlib.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <utility>
 
 #include "CarrtPicoDefines.h"
+#include "EventManager.h"
+#include "SerialMessages.h"
+#include "TelemetryUnits.h"
 
-namespace Batteries
-{
-    constexpr float adcConversionFactor{ 3.3f / ( 1 << 12 ) };
-
-    constexpr float icVoltageDividerFactor{ ( 39.f + 68.f ) / 68.f };
-    constexpr float icConversionFactor{ icVoltageDividerFactor * adcConversionFactor };
+/*
+    The ADC free-runs round-robin over the two battery inputs and DMA moves
+    the results into one half of a ping-pong buffer while the DMA interrupt
+    handler filters the other half.  Round-robin goes in ascending input
+    order starting from the lowest, so the even samples in a block come from
+    the lower numbered input and the odd ones from the higher.
+*/
 
-    constexpr float motorVoltageDividerFactor{ ( 180.f + 82.f ) / 82.f };
-    constexpr float motorConversionFactor{ motorVoltageDividerFactor * adcConversionFactor };
-}    // namespace Batteries
+namespace
+{
+    // Samples per DMA block (half from each battery); 64 ms at 1 kHz
+    constexpr int kBlockSize{ 64 };
+    constexpr int kSamplesPerBattery{ kBlockSize / 2 };
+
+    // Filtered values carry 4 fractional bits so the IIR doesn't stall
+    // short of the input; each block moves it 1/8 of the way (~0.5 sec
+    // time constant at the default sample rate)
+    constexpr int kFilterFractionBits{ 4 };
+    constexpr int kFilterShift{ 3 };
+
+    constexpr unsigned kFirstAdc{
+        std::min( CARRTPICO_IC_BATTERY_ADC, CARRTPICO_MOTOR_BATTERY_ADC ) };
+    constexpr unsigned kIcOffset{ CARRTPICO_IC_BATTERY_ADC == kFirstAdc ? 0u : 1u };
+    constexpr unsigned kMotorOffset{ 1u - kIcOffset };
+
+    constexpr std::uint16_t milliVoltsToCounts( int milliVolts, float dividerFactor )
+    {
+        return static_cast<std::uint16_t>(
+            milliVolts / ( 1000.f * dividerFactor * TelemetryUnits::kAdcVoltsPerCount ) );
+    }
+
+    struct BatteryState
+    {
+        Battery which;
+        unsigned offset;          // Into each pair of samples in a block
+        std::uint16_t lowCounts;
+        std::uint16_t okCounts;
+        volatile std::uint32_t filtered;    // Counts << kFilterFractionBits
+        bool isLow;
+    };
+
+    BatteryState sBatteries[ 2 ]{
+        { Battery::kIcBattery, kIcOffset,
+          milliVoltsToCounts( CARRTPICO_IC_BATTERY_LOW_MV,
+                              TelemetryUnits::kIcVoltageDividerFactor ),
+          milliVoltsToCounts( CARRTPICO_IC_BATTERY_OK_MV,
+                              TelemetryUnits::kIcVoltageDividerFactor ),
+          0, false },
+        { Battery::kMotorBattery, kMotorOffset,
+          milliVoltsToCounts( CARRTPICO_MOTOR_BATTERY_LOW_MV,
+                              TelemetryUnits::kMotorVoltageDividerFactor ),
+          milliVoltsToCounts( CARRTPICO_MOTOR_BATTERY_OK_MV,
+                              TelemetryUnits::kMotorVoltageDividerFactor ),
+          0, false }
+    };
+
+    BatteryState& sIcBattery{ sBatteries[ 0 ] };
+    BatteryState& sMotorBattery{ sBatteries[ 1 ] };
+
+    std::uint16_t sSamples[ 2 ][ kBlockSize ]{};
+    int sFillingBlock{ 0 };
+    bool sFirstBlock{ true };
+    int sDmaChannel{ -1 };
+
+    void startAdc();
+    void filterBlock( const std::uint16_t* block );
+    void adcDmaIrqHandler();
+
+}    // namespace
 
 void Batteries::initBatteries()
 {
@@ -55,20 +122,126 @@ void Batteries::initBatteries()
     // Make sure GPIO is high-impedance, no pullups etc
     adc_gpio_init( CARRTPICO_IC_BATTERY_GPIO );
     adc_gpio_init( CARRTPICO_MOTOR_BATTERY_GPIO );
+
+    adc_set_round_robin( ( 1u << CARRTPICO_IC_BATTERY_ADC )
+                         | ( 1u << CARRTPICO_MOTOR_BATTERY_ADC ) );
+    // FIFO on, DREQ when 1 sample is in it, no error bit, keep all 12 bits
+    adc_fifo_setup( true, true, 1, false, false );
+    adc_set_clkdiv( clock_get_hz( clk_adc ) / CARRTPICO_BATTERY_SAMPLE_HZ - 1 );
+
+    sDmaChannel = dma_claim_unused_channel( true );
+    dma_channel_config cfg{ dma_channel_get_default_config( sDmaChannel ) };
+    channel_config_set_transfer_data_size( &cfg, DMA_SIZE_16 );
+    channel_config_set_read_increment( &cfg, false );
+    channel_config_set_write_increment( &cfg, true );
+    channel_config_set_dreq( &cfg, DREQ_ADC );
+    dma_channel_configure( sDmaChannel, &cfg, sSamples[ sFillingBlock ],
+                           &adc_hw->fifo, kBlockSize, false );
+
+    dma_channel_set_irq0_enabled( sDmaChannel, true );
+    irq_add_shared_handler( DMA_IRQ_0, adcDmaIrqHandler,
+                            PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY );
+    irq_set_enabled( DMA_IRQ_0, true );
+
+    startAdc();
+}
+
+std::uint16_t Batteries::getIcBatteryRaw()
+{
+    return ( sIcBattery.filtered + ( 1u << ( kFilterFractionBits - 1 ) ) )
+           >> kFilterFractionBits;
+}
+
+std::uint16_t Batteries::getMotorBatteryRaw()
+{
+    return ( sMotorBattery.filtered + ( 1u << ( kFilterFractionBits - 1 ) ) )
+           >> kFilterFractionBits;
 }
 
 float Batteries::getIcBatteryVoltage()
 {
-    adc_select_input( CARRTPICO_IC_BATTERY_ADC );
-    std::uint16_t rawValue = adc_read();
-    float batteryVolts = icConversionFactor * rawValue;
-    return batteryVolts;
+    return TelemetryUnits::rawIcBatteryToVolts( getIcBatteryRaw() );
 }
 
 float Batteries::getMotorBatteryVoltage()
 {
-    adc_select_input( CARRTPICO_MOTOR_BATTERY_ADC );
-    std::uint16_t rawValue = adc_read();
-    float batteryVolts = motorConversionFactor * rawValue;
-    return batteryVolts;
+    return TelemetryUnits::rawMotorBatteryToVolts( getMotorBatteryRaw() );
 }
+
+namespace
+{
+
+    void startAdc()
+    {
+        // Round-robin starts from whatever input is selected
+        adc_run( false );
+        adc_fifo_drain();
+        adc_select_input( kFirstAdc );
+        adc_hw->fcs |= ADC_FCS_OVER_BITS;    // Write 1 to clear
+        dma_channel_set_write_addr( sDmaChannel, sSamples[ sFillingBlock ], true );
+        adc_run( true );
+    }
+
+    void filterBlock( const std::uint16_t* block )
+    {
+        for ( auto& battery : sBatteries )
+        {
+            std::uint32_t sum{ 0 };
+            for ( int i = battery.offset; i < kBlockSize; i += 2 )
+            {
+                sum += block[ i ];
+            }
+            std::int32_t average{ static_cast<std::int32_t>(
+                ( sum << kFilterFractionBits ) / kSamplesPerBattery ) };
+
+            std::int32_t filtered{ static_cast<std::int32_t>( battery.filtered ) };
+            filtered = sFirstBlock ? average
+                                   : filtered + ( ( average - filtered ) >> kFilterShift );
+            battery.filtered = static_cast<std::uint32_t>( filtered );
+
+            // Hysteresis: report once on the way down, then stay quiet until
+            // the battery comes back above its OK level (e.g., after a motor
+            // load goes away, or a battery swap)
+            std::uint32_t counts{ static_cast<std::uint32_t>( filtered ) >> kFilterFractionBits };
+            if ( !battery.isLow && counts < battery.lowCounts )
+            {
+                battery.isLow = true;
+                Events().queueEvent( EvtId::kBatteryLowEvent,
+                                     std::to_underlying( battery.which ) );
+            }
+            else if ( battery.isLow && counts > battery.okCounts )
+            {
+                battery.isLow = false;
+            }
+        }
+
+        sFirstBlock = false;
+    }
+
+    void adcDmaIrqHandler()
+    {
+        if ( !dma_channel_get_irq0_status( sDmaChannel ) )
+        {
+            // Another channel's interrupt
+            return;
+        }
+        dma_channel_acknowledge_irq0( sDmaChannel );
+
+        const std::uint16_t* fullBlock{ sSamples[ sFillingBlock ] };
+        sFillingBlock ^= 1;
+
+        if ( adc_hw->fcs & ADC_FCS_OVER_BITS )
+        {
+            // Lost a sample, so odd and even may have swapped; toss the block
+            // and restart the round-robin in step
+            startAdc();
+            return;
+        }
+
+        // The ADC FIFO holds the next few samples while we re-arm
+        dma_channel_set_write_addr( sDmaChannel, sSamples[ sFillingBlock ], true );
+
+        filterBlock( fullBlock );
+    }
+
+}    // namespace
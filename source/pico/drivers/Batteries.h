@@ -27,10 +27,23 @@
  * \copyright Copyright (c) 2026
  */
 
+#include <cstdint>
+
 namespace Batteries
 {
+    // Starts the ADC sampling both batteries in the background (uses a DMA
+    // channel and DMA_IRQ_0 on the calling core, which CARRT-Pico makes
+    // Core1); queues EvtId::kBatteryLowEvent, with the Battery as the
+    // parameter, when a battery drops below its low threshold
     void initBatteries();
 
+    // Filtered 12-bit ADC counts (cheap to call from either core, just
+    // loads the latest value); see TelemetryUnits.h to convert to volts
+    std::uint16_t getIcBatteryRaw();
+    std::uint16_t getMotorBatteryRaw();
+
+    // These use software floating point (the Pico has no FPU), so keep
+    // them out of the event loop
     float getIcBatteryVoltage();
 
     float getMotorBatteryVoltage();
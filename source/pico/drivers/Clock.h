@@ -20,6 +20,7 @@
 #ifndef Clock_h
 #define Clock_h
 
+#include <hardware/timer.h>
 #include <pico/time.h>
 
 #include <chrono>
@@ -45,6 +46,9 @@ namespace Clock
         return to_ms_since_boot( get_absolute_time() );
     }
 
+    // Wraps every ~71 minutes; fine for differences
+    inline std::uint32_t micros() { return time_us_32(); }
+
     inline std::chrono::milliseconds elapsedMilliseconds()
     {
         return std::chrono::milliseconds{ Clock::millis() };
@@ -1,5 +1,5 @@
 /*
-    Encoders.cpp - Track interrupts from the wheel encoders.
+    Encoders.cpp - Count edges from the wheel encoders.
 
     Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
 
@@ -19,109 +19,243 @@
 
 #include "Encoders.h"
 
+#include <hardware/clocks.h>
 #include <hardware/gpio.h>
+#include <hardware/pio.h>
+#include <hardware/timer.h>
+#include <pico/critical_section.h>
 
 #include <cstdint>
+#include <utility>
 
 #include "CarrtPicoDefines.h"
-#include "Clock.h"
+#include "CriticalSection.h"
+#include "EncoderEdges.pio.h"
 #include "EventManager.h"
 
 /***************************************************/
 
-// All this code intended to run on Core 1
+// Except for takeCounts(), all this code intended to run on Core 1
 
 /***************************************************/
 
 namespace Encoders
 {
-    void configureEncoderGpio( uint pin ) noexcept;
-    void encoderCallBack( uint, std::uint32_t events );
+    bool configureStateMachine( int side, uint pin, uint offset ) noexcept;
 }    // namespace Encoders
 
+namespace
+{
+    constexpr int kLeft{ 0 };
+    constexpr int kRight{ 1 };
+
+    // The PIO program runs 8 cycle ticks, one per microsecond
+    constexpr std::uint32_t kPioCyclesPerUs{ 8 };
+
+    // Edge words hold 24 bits of time and 8 of count
+    constexpr std::uint32_t kTimeMask{ 0x00FF'FFFF };
+    constexpr int kCountShift{ 24 };
+    constexpr std::uint32_t kCountMask{ 0xFF };
+
+    // The PIO reports an edge after the glitch filter has confirmed it
+    constexpr std::uint32_t kEdgeReportDelayUs{ CARRTPICO_ENCODER_GLITCH_FILTER_US + 1 };
+
+    static_assert( CARRTPICO_ENCODER_GLITCH_FILTER_US >= 1
+                   && CARRTPICO_ENCODER_GLITCH_FILTER_US <= 32 );
+
+    // Written by the Core1 sampling timer, read (and counts reset) by Core0;
+    // always under sCountsLock so the counts and edge times of both sides
+    // are taken together
+    critical_section_t sCountsLock{};
+    Encoders::Counts sCounts{};
+
+    // Only used on Core1
+    int sStateMachine[ 2 ]{ -1, -1 };
+    std::uint32_t sLastPioCount[ 2 ]{ 0, 0 };
+    std::uint32_t sPioStartTime{ 0 };
+
+}    // namespace
+
 /*!
- * \brief Initializes the encoder GPIO with interrupts for count
+ * \brief Loads the edge counting program into PIO and starts a state
+ * machine on each encoder pin
  *
  * This function is designed/configured to be called from and run on Core1
  *
  */
 void Encoders::initEncoders() noexcept
 {
-    // Set the call back function (it's a generic/universal callback on Pico)
-    gpio_set_irq_callback( Encoders::encoderCallBack );
+    critical_section_init( &sCountsLock );
 
-    // Configure each of relevant pins
-    configureEncoderGpio( CARRTPICO_ENCODER_LEFT_GPIO );
-    configureEncoderGpio( CARRTPICO_ENCODER_RIGHT_GPIO );
+    PIO pio{ CARRTPICO_ENCODER_PIO };
 
-    irq_set_enabled( IO_IRQ_BANK0, true );
+    if ( !pio_can_add_program( pio, &encoder_edges_program ) )
+    {
+        // Core0 reports it to the RPi0 (like Core1, the param says what
+        // failed)
+        Events().queueEvent( EvtId::kErrorEvent, std::to_underlying( EvtId::kInitEncoders ), 0,
+                             EventManager::kUrgentPriority );
+        return;
+    }
+    uint offset{ pio_add_program( pio, &encoder_edges_program ) };
+
+    if ( !configureStateMachine( kLeft, CARRTPICO_ENCODER_LEFT_GPIO, offset )
+         || !configureStateMachine( kRight, CARRTPICO_ENCODER_RIGHT_GPIO, offset ) )
+    {
+        Events().queueEvent( EvtId::kErrorEvent, std::to_underlying( EvtId::kInitEncoders ), 0,
+                             EventManager::kUrgentPriority );
+        return;
+    }
+
+    // Start both together so they share a time base (the 24 bit time in
+    // each edge word counts microseconds from here)
+    sPioStartTime = time_us_32();
+    pio_enable_sm_mask_in_sync(
+        pio, ( 1u << sStateMachine[ kLeft ] ) | ( 1u << sStateMachine[ kRight ] ) );
 }
 
 /*!
- * \brief Configure encoder pins as inputs with pull down and enables interrupts
+ * \brief Configures a state machine (not yet running) to count edges on pin
  *
  * This function is designed/configured to be called from and run on Core1
  *
+ * \param side (kLeft or kRight)
  * \param pin (GPIO pin number)
+ * \param offset (where the program is loaded)
+ *
+ * \return false if there is no free state machine
  */
-void Encoders::configureEncoderGpio( uint pin ) noexcept
+bool Encoders::configureStateMachine( int side, uint pin, uint offset ) noexcept
 {
-    gpio_init( pin );
-    gpio_set_dir( pin, GPIO_IN );
+    PIO pio{ CARRTPICO_ENCODER_PIO };
+
+    int sm{ pio_claim_unused_sm( pio, false ) };
+    if ( sm < 0 )
+    {
+        return false;
+    }
+    sStateMachine[ side ] = sm;
+
+    pio_gpio_init( pio, pin );
     gpio_pull_down( pin );
-    gpio_set_irq_enabled( pin, ( GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE ), true );
+    pio_sm_set_consecutive_pindirs( pio, sm, pin, 1, false );
+
+    pio_sm_config c{ encoder_edges_program_get_default_config( offset ) };
+    sm_config_set_jmp_pin( &c, pin );
+    sm_config_set_in_shift( &c, false, false, 32 );
+    // The pull threshold is the glitch filter length (in 1 us samples)
+    sm_config_set_out_shift( &c, false, false, CARRTPICO_ENCODER_GLITCH_FILTER_US );
+    sm_config_set_fifo_join( &c, PIO_FIFO_JOIN_RX );
+    sm_config_set_clkdiv( &c, static_cast<float>( clock_get_hz( clk_sys ) )
+                                  / ( kPioCyclesPerUs * 1'000'000 ) );
+
+    // Start in the state that matches the pin so we don't count a phantom edge
+    uint start{ offset
+                + ( gpio_get( pin ) ? encoder_edges_offset_high : encoder_edges_offset_low ) };
+    pio_sm_init( pio, sm, start, &c );
+
+    // Count and time both start at zero
+    pio_sm_exec( pio, sm, pio_encode_set( pio_x, 0 ) );
+    pio_sm_exec( pio, sm, pio_encode_set( pio_y, 0 ) );
+
+    return true;
 }
 
 /*!
- * \brief Called when either encoder pin triggers
+ * \brief Drains the edge words the state machines have pushed and adds
+ * the new edges to the counts
+ *
+ * This function is designed/configured to be called from and run on Core1
+ * (from a repeating timer, often enough that the 8 word FIFOs never fill)
  *
- * \param gpio (the GPIO pin that triggered the interrupt)
- * \param events (the interrupt event type)
  */
-void Encoders::encoderCallBack( uint gpio, std::uint32_t events )
+void Encoders::sampleCounts() noexcept
 {
-    constexpr int kLeft{ 0 };
-    constexpr int kRight{ 1 };
+    PIO pio{ CARRTPICO_ENCODER_PIO };
 
-    static std::uint32_t lastInterrupt[ 2 ]{ 0, 0 };
-    static EvtId encoderEvt[ 2 ]{ EvtId::kEncoderLeftEvent, EvtId::kEncoderRightEvent };
+    int newEdges[ 2 ]{ 0, 0 };
+    std::uint32_t lastEdgeTime[ 2 ]{ 0, 0 };
 
-    int side;
-    if ( gpio == CARRTPICO_ENCODER_LEFT_GPIO )
-    {
-        side = kLeft;
-    }
-    else if ( gpio == CARRTPICO_ENCODER_RIGHT_GPIO )
+    for ( int side : { kLeft, kRight } )
     {
-        side = kRight;
+        int sm{ sStateMachine[ side ] };
+        if ( sm < 0 || pio_sm_is_rx_fifo_empty( pio, sm ) )
+        {
+            continue;
+        }
+
+        // Counts are cumulative, so only the latest word matters
+        std::uint32_t word{ 0 };
+        while ( !pio_sm_is_rx_fifo_empty( pio, sm ) )
+        {
+            word = pio_sm_get( pio, sm );
+        }
+
+        // Both the count and time count down in the PIO
+        std::uint32_t pioCount{ ( 0u - ( word >> kCountShift ) ) & kCountMask };
+        newEdges[ side ] = static_cast<int>( ( pioCount - sLastPioCount[ side ] ) & kCountMask );
+        sLastPioCount[ side ] = pioCount;
+
+        // Undo the 24 bit wrap using how long ago (< 16 s) the edge was;
+        // the PIO and system timer clocks both come from the crystal
+        std::uint32_t edgeUs{ ( 0u - word ) & kTimeMask };
+        std::uint32_t now{ time_us_32() };
+        std::uint32_t ageUs{ ( now - sPioStartTime - edgeUs ) & kTimeMask };
+        lastEdgeTime[ side ] = now - ageUs - kEdgeReportDelayUs;
     }
-    else
+
+    if ( newEdges[ kLeft ] == 0 && newEdges[ kRight ] == 0 )
     {
-        // Paranoid error -- only the encoder pins are configured to interrupt
-        Events().queueEvent( EvtId::kErrorEvent, gpio );    // TODO argument should be error code
         return;
     }
 
-    std::uint32_t tick = Clock::millis();
-    if ( tick - lastInterrupt[ side ] < PICO_GPIO_DEBOUNCE_TIME )
+    CriticalSection block( sCountsLock );
+
+    // A side with no new edges keeps its previous edge time
+    if ( newEdges[ kLeft ] )
     {
-        // Debounce
-        return;
+        sCounts.left += newEdges[ kLeft ];
+        sCounts.leftLastEdgeTime = lastEdgeTime[ kLeft ];
     }
+    if ( newEdges[ kRight ] )
+    {
+        sCounts.right += newEdges[ kRight ];
+        sCounts.rightLastEdgeTime = lastEdgeTime[ kRight ];
+    }
+}
 
-    lastInterrupt[ side ] = tick;
-
-    int direction = 0;
-    if ( events & GPIO_IRQ_EDGE_FALL )
+/*!
+ * \brief Returns edges counted on each side since the last call
+ *
+ * This function is designed to be called from and run on Core0
+ * (once per nav update)
+ *
+ * \return the counts and time of the last edge on each side
+ */
+Encoders::Counts Encoders::takeCounts() noexcept
+{
+    // Nothing can have been counted before Core1 runs initEncoders()
+    if ( !critical_section_is_initialized( &sCountsLock ) )
     {
-        direction = -1;
+        return Counts{};
     }
-    else if ( events & GPIO_IRQ_EDGE_RISE )
+
+    CriticalSection block( sCountsLock );
+
+    Counts counts{ sCounts };
+    sCounts.left = 0;
+    sCounts.right = 0;
+    return counts;
+}
+
+Encoders::Counts Encoders::peekCounts() noexcept
+{
+    if ( !critical_section_is_initialized( &sCountsLock ) )
     {
-        direction = 1;
+        return Counts{};
     }
 
-    Events().queueEvent( encoderEvt[ side ], direction, tick );
+    CriticalSection block( sCountsLock );
 
-    return;
+    return sCounts;
 }
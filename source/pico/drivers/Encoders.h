@@ -1,5 +1,5 @@
 /*
-    Encoders.h - Track interrupts from the wheel encoders.
+    Encoders.h - Count edges from the wheel encoders.
 
     Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
 
@@ -20,11 +20,34 @@
 #ifndef Encoders_h
 #define Encoders_h
 
+#include <cstdint>
+
 namespace Encoders
 {
 
+    // Edges counted since the previous call to takeCounts() and the
+    // time (us, from time_us_32()) of the most recent edge on each side
+    struct Counts
+    {
+        int left;
+        int right;
+        std::uint32_t leftLastEdgeTime;
+        std::uint32_t rightLastEdgeTime;
+    };
+
+    // Edges are counted (and glitch filtered) by PIO state machines; Core1
+    // calls sampleCounts() periodically to collect them
     void initEncoders() noexcept;
 
+    void sampleCounts() noexcept;
+
+    // Takes both sides' counts and edge times in one go (Core1 can't
+    // update them part way through)
+    Counts takeCounts() noexcept;
+
+    // Same, but leaves the counts for the next takeCounts()
+    Counts peekCounts() noexcept;
+
 };
 
 #endif    // Encoders_h
@@ -19,13 +19,52 @@
 
 #include "I2C.h"
 
+#include <hardware/irq.h>
+#include <hardware/sync.h>
+#include <pico/mutex.h>
+
 #include <cstring>
 
 #include "CarrtError.h"
 #include "CarrtPicoDefines.h"
+#include "Clock.h"
+#include "EventManager.h"
+#include "SpscQueue.hpp"
 #include "hardware/i2c.h"
 #include "pico/stdlib.h"
 
+namespace
+{
+    // Depth of both the TX (command) and RX FIFOs
+    constexpr unsigned kFifoDepth{ 16 };
+
+    // Thread code pushes; the interrupt handler pops (so does submit(), but
+    // only with the interrupt disabled)
+    SpscQueue<I2C::Transfer*, CARRTPICO_I2C_TRANSFER_QUEUE_SIZE> sTransfers{};
+
+    // State of the transfer on the bus; only the interrupt handler (or
+    // submit() with the interrupt disabled) changes these
+    I2C::Transfer* volatile sCurrent{ nullptr };
+    unsigned sCmdsSent{ 0 };    // Register byte plus one per data byte
+    unsigned sBytesRead{ 0 };
+    bool sAborted{ false };
+    std::uint32_t sStartedUs{ 0 };
+
+    // Recursive, so a BusLock holder can still call send() and receive()
+    recursive_mutex_t sBusMutex;
+
+    int i2cIrq()
+    {
+        return i2c_hw_index( CARRTPICO_I2C_PORT ) == 0 ? I2C0_IRQ : I2C1_IRQ;
+    }
+
+    void startNextTransfer();
+    void finishTransfer( I2C::Transfer* xfer, bool ok );
+    void feedTxFifo( i2c_hw_t* hw, const I2C::Transfer& xfer );
+    void i2cIrqHandler();
+
+}    // namespace
+
 void I2C::initI2C() noexcept
 {
     // I2C Initialisation
@@ -35,16 +74,254 @@ void I2C::initI2C() noexcept
     gpio_set_function( CARRTPICO_I2C_SCL, GPIO_FUNC_I2C );
     gpio_pull_up( CARRTPICO_I2C_SDA );
     gpio_pull_up( CARRTPICO_I2C_SCL );
+
+    recursive_mutex_init( &sBusMutex );
+
+    // Interrupts stay masked in the I2C block except during a transfer
+    i2c_get_hw( CARRTPICO_I2C_PORT )->intr_mask = 0;
+    irq_set_exclusive_handler( i2cIrq(), i2cIrqHandler );
+    irq_set_enabled( i2cIrq(), true );
+}
+
+I2C::BusLock::BusLock() noexcept : mOwnsBus{ true }
+{
+    recursive_mutex_enter_blocking( &sBusMutex );
+}
+
+I2C::BusLock::BusLock( TryOnly ) noexcept
+    : mOwnsBus{ recursive_mutex_try_enter( &sBusMutex, nullptr ) }
+{}
+
+I2C::BusLock::~BusLock()
+{
+    if ( mOwnsBus )
+    {
+        recursive_mutex_exit( &sBusMutex );
+    }
+}
+
+bool I2C::submit( Transfer* transfer ) noexcept
+{
+    transfer->status = TransferStatus::kQueued;
+    if ( !sTransfers.tryPush( transfer ) )
+    {
+        return false;
+    }
+
+    // If the engine is idle, start it (keeping the handler out so it can't
+    // start the same transfer between our check and our start)
+    irq_set_enabled( i2cIrq(), false );
+    if ( !sCurrent )
+    {
+        startNextTransfer();
+    }
+    irq_set_enabled( i2cIrq(), true );
+
+    return true;
+}
+
+bool I2C::isIdle() noexcept { return !sCurrent && sTransfers.isEmpty(); }
+
+bool I2C::abortOverdueTransfer() noexcept
+{
+    // Keep the handler out while we look at (and maybe end) the transfer
+    irq_set_enabled( i2cIrq(), false );
+
+    I2C::Transfer* xfer{ sCurrent };
+    bool overdue{ xfer && Clock::micros() - sStartedUs > CARRTPICO_I2C_TIMEOUT_US };
+    if ( overdue )
+    {
+        // Disabling the block drops the transfer and flushes both FIFOs;
+        // enable it again for the blocking calls (startNextTransfer() does
+        // the same if there's another transfer waiting)
+        i2c_hw_t* hw{ i2c_get_hw( CARRTPICO_I2C_PORT ) };
+        hw->intr_mask = 0;
+        hw->enable = 0;
+        hw->enable = 1;
+
+        finishTransfer( xfer, false );
+    }
+
+    irq_set_enabled( i2cIrq(), true );
+
+    return overdue;
 }
 
+namespace
+{
+
+    // Returns false if the bus is still busy after CARRTPICO_I2C_TIMEOUT_US
+    bool waitForIdle()
+    {
+        std::uint32_t start{ Clock::micros() };
+        while ( !I2C::isIdle() )
+        {
+            if ( Clock::micros() - start > CARRTPICO_I2C_TIMEOUT_US )
+            {
+                return false;
+            }
+            tight_loop_contents();
+        }
+        return true;
+    }
+
+    void startNextTransfer()
+    {
+        I2C::Transfer* next{ nullptr };
+        if ( !sTransfers.tryPop( &next ) )
+        {
+            sCurrent = nullptr;
+            return;
+        }
+
+        i2c_hw_t* hw{ i2c_get_hw( CARRTPICO_I2C_PORT ) };
+
+        // The target address can only change while the block is disabled
+        hw->enable = 0;
+        hw->tar = next->address;
+        hw->enable = 1;
+
+        sCmdsSent = 0;
+        sBytesRead = 0;
+        sAborted = false;
+        sStartedUs = Clock::micros();
+        next->status = I2C::TransferStatus::kInProgress;
+        sCurrent = next;
+
+        // Interrupt on every received byte and whenever the TX FIFO runs
+        // dry; TX_EMPTY fires right away, so the handler does the rest
+        hw->rx_tl = 0;
+        hw->tx_tl = 0;
+        static_cast<void>( hw->clr_intr );
+        hw->intr_mask = I2C_IC_INTR_MASK_M_TX_EMPTY_BITS | I2C_IC_INTR_MASK_M_RX_FULL_BITS
+                        | I2C_IC_INTR_MASK_M_TX_ABRT_BITS | I2C_IC_INTR_MASK_M_STOP_DET_BITS;
+    }
+
+    void feedTxFifo( i2c_hw_t* hw, const I2C::Transfer& xfer )
+    {
+        const unsigned totalCmds{ 1u + xfer.len };
+
+        while ( sCmdsSent < totalCmds && hw->txflr < kFifoDepth )
+        {
+            // Don't ask for more bytes than the RX FIFO can hold
+            if ( xfer.isRead && sCmdsSent > 0
+                 && ( sCmdsSent - 1 ) - sBytesRead >= kFifoDepth )
+            {
+                break;
+            }
+
+            bool last{ sCmdsSent + 1 == totalCmds };
+            std::uint32_t cmd{ last ? I2C_IC_DATA_CMD_STOP_BITS : 0u };
+
+            if ( sCmdsSent == 0 )
+            {
+                cmd |= xfer.reg;
+            }
+            else if ( xfer.isRead )
+            {
+                // Repeated start between the register write and the reads
+                cmd |= I2C_IC_DATA_CMD_CMD_BITS;
+                if ( sCmdsSent == 1 )
+                {
+                    cmd |= I2C_IC_DATA_CMD_RESTART_BITS;
+                }
+            }
+            else
+            {
+                cmd |= xfer.data[ sCmdsSent - 1 ];
+            }
+
+            hw->data_cmd = cmd;
+            ++sCmdsSent;
+        }
+
+        if ( sCmdsSent == totalCmds )
+        {
+            hw_clear_bits( &hw->intr_mask, I2C_IC_INTR_MASK_M_TX_EMPTY_BITS );
+        }
+    }
+
+    void i2cIrqHandler()
+    {
+        i2c_hw_t* hw{ i2c_get_hw( CARRTPICO_I2C_PORT ) };
+        I2C::Transfer* xfer{ sCurrent };
+
+        if ( !xfer )
+        {
+            hw->intr_mask = 0;
+            return;
+        }
+
+        std::uint32_t status{ hw->intr_stat };
+
+        if ( status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS )
+        {
+            // The block flushes the TX FIFO and sends a STOP (handled below)
+            static_cast<void>( hw->clr_tx_abrt );
+            sAborted = true;
+            hw_clear_bits( &hw->intr_mask, I2C_IC_INTR_MASK_M_TX_EMPTY_BITS );
+        }
+
+        while ( hw->rxflr > 0 )
+        {
+            // Reading data_cmd pops the RX FIFO
+            auto byte{ static_cast<unsigned char>( hw->data_cmd ) };
+            if ( xfer->isRead && sBytesRead < xfer->len )
+            {
+                xfer->data[ sBytesRead++ ] = byte;
+            }
+        }
+
+        if ( !sAborted )
+        {
+            feedTxFifo( hw, *xfer );
+        }
+
+        if ( status & I2C_IC_INTR_STAT_R_STOP_DET_BITS )
+        {
+            static_cast<void>( hw->clr_stop_det );
+            hw->intr_mask = 0;
+
+            finishTransfer( xfer, !sAborted && ( !xfer->isRead || sBytesRead == xfer->len ) );
+        }
+    }
+
+    // From the handler, or thread code with the handler kept out
+    void finishTransfer( I2C::Transfer* xfer, bool ok )
+    {
+        xfer->status = ok ? I2C::TransferStatus::kDone : I2C::TransferStatus::kFailed;
+        if ( xfer->doneEvent != EvtId::kNullEvent )
+        {
+            Events().queueEvent( xfer->doneEvent, xfer->doneParam, Clock::millis(),
+                                 xfer->urgent ? EventManager::kHighPriority
+                                              : EventManager::kLowPriority );
+        }
+        else
+        {
+            // Wake a poller waiting in __wfe()
+            __sev();
+        }
+
+        startNextTransfer();
+    }
+
+}    // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 
 extern "C" signed char I2C::send( unsigned char address, unsigned char reg,
                                   unsigned char* data,
                                   unsigned char len ) noexcept
 {
-    // Actual longest message sent to BNO055 is 18 bytes; need +1 for address
-    constexpr int kCarrtBNO055MaxSentMsgLen = 18;
+    BusLock lock;
+    if ( !waitForIdle() )
+    {
+        return PICO_ERROR_TIMEOUT;
+    }
+
+    // Longest message sent to BNO055 is the 22 byte calibration profile;
+    // need +1 for address
+    constexpr int kCarrtBNO055MaxSentMsgLen = 22;
 
     if ( len > kCarrtBNO055MaxSentMsgLen )
     {
@@ -58,8 +335,8 @@ extern "C" signed char I2C::send( unsigned char address, unsigned char reg,
     // Count the reg entry in array[0]
     ++len;
 
-    int ret =
-        i2c_write_blocking( CARRTPICO_I2C_PORT, address, array, len, false );
+    int ret = i2c_write_timeout_us( CARRTPICO_I2C_PORT, address, array, len, false,
+                                    CARRTPICO_I2C_TIMEOUT_US );
 
     if ( ret == len )
     {
@@ -77,13 +354,20 @@ extern "C" signed char I2C::receive( unsigned char address, unsigned char reg,
                                      unsigned char* data,
                                      unsigned char len ) noexcept
 {
+    BusLock lock;
+    if ( !waitForIdle() )
+    {
+        return PICO_ERROR_TIMEOUT;
+    }
+
     // Write the register address without a STOP...
-    int ret = i2c_write_blocking( CARRTPICO_I2C_PORT, address, &reg, 1, true );
+    int ret = i2c_write_timeout_us( CARRTPICO_I2C_PORT, address, &reg, 1, true,
+                                    CARRTPICO_I2C_TIMEOUT_US );
     if ( ret == 1 )
     {
         // Then read the data...
-        ret =
-            i2c_read_blocking( CARRTPICO_I2C_PORT, address, data, len, false );
+        ret = i2c_read_timeout_us( CARRTPICO_I2C_PORT, address, data, len, false,
+                                   CARRTPICO_I2C_TIMEOUT_US );
         if ( ret == len )
         {
             ret = 0;
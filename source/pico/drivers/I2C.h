@@ -20,11 +20,93 @@
 #ifndef I2C_h
 #define I2C_h
 
+#include <cstdint>
+
+#include "Event.h"
+
 namespace I2C
 {
 
+    // Also installs the interrupt handler for transfers, so call on the
+    // core that submits them (CARRT-Pico has Core1 do it); call before
+    // either core uses the bus
     void initI2C() noexcept;
 
+    // Core1 samples the BNO055 while Core0 still sets it up, so whoever
+    // uses the bus holds a BusLock for as long as what it's doing must not
+    // be interleaved with the other core (e.g., a mode switch, the read,
+    // and the switch back, or a submitted transfer until it ends).  It's
+    // recursive, so send() and receive() (which take it themselves) work
+    // inside one.  Never use from an interrupt.
+    class BusLock
+    {
+    public:
+        struct TryOnly
+        {
+        };
+
+        // Waits for the other core to let go of the bus
+        BusLock() noexcept;
+
+        // Doesn't wait; check ownsBus()
+        explicit BusLock( TryOnly ) noexcept;
+
+        ~BusLock();
+
+        BusLock( const BusLock& ) = delete;
+        BusLock& operator=( const BusLock& ) = delete;
+
+        bool ownsBus() const noexcept { return mOwnsBus; }
+
+    private:
+        bool mOwnsBus;
+    };
+
+    // Interrupt-driven register reads and writes.  Transfers run one at a
+    // time in the order submitted; when one ends, its doneEvent is queued
+    // (with doneParam) so the caller can pick up the result, or, with
+    // EvtId::kNullEvent, the caller polls status instead.  Only submit from
+    // thread code on the core that called initI2C().
+
+    enum class TransferStatus : std::uint8_t
+    {
+        kQueued,
+        kInProgress,
+        kDone,
+        kFailed
+    };
+
+    struct Transfer
+    {
+        unsigned char address;
+        unsigned char reg;
+        unsigned char* data;    // Caller's buffer of len bytes
+        unsigned char len;
+        bool isRead;
+        EvtId doneEvent;
+        int doneParam;
+        bool urgent;    // Queue doneEvent as a high priority event
+        volatile TransferStatus status;
+    };
+
+    // Transfer and its data must stay put until status is kDone or kFailed;
+    // returns false if the queue is full
+    bool submit( Transfer* transfer ) noexcept;
+
+    bool isIdle() noexcept;
+
+    // Only the interrupt ends a transfer (on the STOP), so one on a stuck
+    // bus (a slave holding SCL or SDA low) would never end.  Call this
+    // regularly from thread code on the core that called initI2C(): it
+    // aborts the transfer on the bus if it has run longer than
+    // CARRTPICO_I2C_TIMEOUT_US, marks it kFailed (queuing its doneEvent as
+    // usual) and starts the next.  Returns true if it aborted one.
+    bool abortOverdueTransfer() noexcept;
+
+    // The blocking functions below wait for submitted transfers to finish
+    // before using the bus, and give up (returning an error) after
+    // CARRTPICO_I2C_TIMEOUT_US rather than hang on a stuck bus
+
     extern "C"
     {
         signed char send( unsigned char address, unsigned char reg,
@@ -22,6 +22,7 @@
 #include "SerialLinkPico.h"
 
 #include <hardware/gpio.h>
+#include <hardware/irq.h>
 #include <hardware/uart.h>
 #include <pico/binary_info.h>
 
@@ -33,6 +34,21 @@ namespace
     constexpr int kMaxReadAttempts{ 16 };
 
     constexpr auto kSmallPause{ 50us };
+
+    int serialLinkIrq()
+    {
+        return uart_get_index( CARRTPICO_SERIAL_LINK_UART ) == 0 ? UART0_IRQ
+                                                                   : UART1_IRQ;
+    }
+
+    void rxWakeupHandler()
+    {
+        // Taking the interrupt is what wakes the main loop; the data stays
+        // in the FIFO for the normal reads.  Mask the interrupt or it would
+        // keep firing until the FIFO is drained.
+        uart_set_irq_enables( CARRTPICO_SERIAL_LINK_UART, false, false );
+    }
+
 }    // namespace
 
 /*****************************************************************
@@ -54,10 +70,20 @@ SerialLinkPico::SerialLinkPico() noexcept
     // Set the GPIO pin mux to the UART
     gpio_set_function( CARRTPICO_SERIAL_LINK_UART_TX_GPIO, GPIO_FUNC_UART );
     gpio_set_function( CARRTPICO_SERIAL_LINK_UART_RX_GPIO, GPIO_FUNC_UART );
+
+    // RX wake-up interrupt is installed (on this core) but stays
+    // masked in the UART until armRxWakeup() is called
+    uart_set_irq_enables( CARRTPICO_SERIAL_LINK_UART, false, false );
+    irq_set_exclusive_handler( serialLinkIrq(), rxWakeupHandler );
+    irq_set_enabled( serialLinkIrq(), true );
 }
 
 SerialLinkPico::~SerialLinkPico() noexcept
 {
+    uart_set_irq_enables( CARRTPICO_SERIAL_LINK_UART, false, false );
+    irq_set_enabled( serialLinkIrq(), false );
+    irq_remove_handler( serialLinkIrq(), rxWakeupHandler );
+
     // Shutdown the Serial-Link UART
     gpio_set_function( CARRTPICO_SERIAL_LINK_UART_TX_GPIO, GPIO_FUNC_NULL );
     gpio_set_function( CARRTPICO_SERIAL_LINK_UART_RX_GPIO, GPIO_FUNC_NULL );
@@ -69,12 +95,25 @@ bool SerialLinkPico::isReadable() noexcept
     return uart_is_readable( CARRTPICO_SERIAL_LINK_UART );
 }
 
+void SerialLinkPico::armRxWakeup() noexcept
+{
+    // RX interrupt fires at 4 bytes in the FIFO or after a 32 bit-period
+    // receive timeout, whichever comes first
+    uart_set_irq_enables( CARRTPICO_SERIAL_LINK_UART, true, false );
+}
+
+std::uint32_t SerialLinkPico::millisSinceLastMsg() const noexcept
+{
+    return Clock::millis() - mLastMsgMs;
+}
+
 std::optional<MsgId> SerialLinkPico::getMsgType()
 {
     // Reading always blocks, so make semantics the same by first
     // checking if there is data to read
     if ( isReadable() )
     {
+        mLastMsgMs = Clock::millis();
         return static_cast<MsgId>( uart_getc( CARRTPICO_SERIAL_LINK_UART ) );
     }
     else
@@ -56,8 +56,17 @@ public:
     // Additional functions (not part of base class)
     bool isReadable() noexcept;
 
+    // Enable a one-shot UART RX interrupt whose only job is to end a
+    // __wfe() when data arrives; the interrupt disables itself, so call
+    // this again before each __wfe()
+    void armRxWakeup() noexcept;
+
+    // How long since the last msg from the RPi0 started arriving
+    std::uint32_t millisSinceLastMsg() const noexcept;
+
 private:
     int mSerialPort;
+    std::uint32_t mLastMsgMs{ 0 };
 };
 
 #endif    // SerialLink_h
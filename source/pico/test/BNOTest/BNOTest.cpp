@@ -108,7 +108,7 @@ int main()
         gpio_init( CARRTPICO_HEARTBEAT_LED );
         gpio_set_dir( CARRTPICO_HEARTBEAT_LED, GPIO_OUT );
 
-        SerialMessageProcessor smp( 10, rpi0 );
+        SerialMessageProcessor smp( rpi0 );
         smp.registerMessage<TimerControlMsg>( MsgId::kTimerControl );
         smp.registerMessage<DebugLinkMsg>( MsgId::kDebugSerialLink );
 
@@ -0,0 +1,217 @@
+/*
+    MultiLevelQueueTest.cpp - Host unit test of MultiLevelQueue: priority
+    order, aging, tie-breaks, the minLevel cut-off, and statistics.
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+#include "MultiLevelQueue.hpp"
+
+namespace
+{
+    // Three levels (low, normal, high) and two producers (one per core),
+    // like the EventManager's queues
+    using TestQueue = MultiLevelQueue<int, 2, 4, 8, 4>;
+
+    constexpr std::size_t kLow{ 0 };
+    constexpr std::size_t kNormal{ 1 };
+    constexpr std::size_t kHigh{ 2 };
+
+    int sFailures{ 0 };
+
+    void check( bool ok, const char* what, int line )
+    {
+        if ( !ok )
+        {
+            std::cout << "FAILED line " << line << ": " << what << std::endl;
+            ++sFailures;
+        }
+    }
+
+#define CHECK( x ) check( ( x ), #x, __LINE__ )
+
+    // Pops one item and checks it is the expected one (and level)
+    void expectPop( TestQueue& q, std::uint32_t nowUs, int expected, std::size_t expectedLevel,
+                    int line, std::size_t minLevel = 0 )
+    {
+        int item{ -1 };
+        std::size_t level{ 99 };
+        bool popped{ q.tryPop( nowUs, &item, nullptr, &level, minLevel ) };
+        check( popped, "tryPop() found an item", line );
+        check( item == expected, "popped the expected item", line );
+        check( level == expectedLevel, "popped from the expected level", line );
+    }
+
+    void testStrictPriority()
+    {
+        TestQueue q;
+
+        q.tryPush( kLow, 0, 1, 0 );
+        q.tryPush( kNormal, 1, 2, 10 );
+        q.tryPush( kHigh, 0, 3, 20 );
+        q.tryPush( kNormal, 0, 4, 30 );
+
+        // No aging set, so strictly by level whatever the age
+        expectPop( q, 100, 3, kHigh, __LINE__ );
+        expectPop( q, 100, 2, kNormal, __LINE__ );
+        expectPop( q, 100, 4, kNormal, __LINE__ );
+        expectPop( q, 100, 1, kLow, __LINE__ );
+
+        int item;
+        CHECK( !q.tryPop( 100, &item ) );
+        CHECK( q.isEmpty() );
+    }
+
+    void testOldestFirstAmongEquals()
+    {
+        TestQueue q;
+
+        // Same level, different producers: the older one goes first
+        // whichever producer it came from
+        q.tryPush( kNormal, 1, 10, 100 );
+        q.tryPush( kNormal, 0, 11, 200 );
+        q.tryPush( kNormal, 1, 12, 300 );
+
+        std::uint32_t queuedAt{ 0 };
+        int item{ -1 };
+        CHECK( q.tryPop( 1000, &item, &queuedAt ) );
+        CHECK( item == 10 );
+        CHECK( queuedAt == 100 );
+
+        expectPop( q, 1000, 11, kNormal, __LINE__ );
+        expectPop( q, 1000, 12, kNormal, __LINE__ );
+    }
+
+    void testAgingPromotesOneLevel()
+    {
+        TestQueue q;
+        q.setAgingUs( kLow, 1000 );
+        q.setAgingUs( kHigh, 5 );    // Top level can't age; ignored
+        CHECK( q.getAgingUs( kLow ) == 1000 );
+        CHECK( q.getAgingUs( kHigh ) == 0 );
+
+        q.tryPush( kLow, 0, 1, 0 );
+        q.tryPush( kNormal, 1, 2, 500 );
+
+        // Not old enough yet: normal wins
+        expectPop( q, 900, 2, kNormal, __LINE__ );
+
+        // Old enough: competes with normal, and being older wins the tie
+        q.tryPush( kNormal, 1, 3, 1000 );
+        expectPop( q, 1500, 1, kLow, __LINE__ );
+        expectPop( q, 1500, 3, kNormal, __LINE__ );
+
+        // Aged items only ever get promoted by one level
+        q.tryPush( kLow, 0, 4, 0 );
+        q.tryPush( kHigh, 1, 5, 9000 );
+        expectPop( q, 10'000, 5, kHigh, __LINE__ );
+        expectPop( q, 10'000, 4, kLow, __LINE__ );
+
+        // An item stamped (on the other core) just after nowUs isn't aged
+        q.tryPush( kLow, 1, 6, 2000 );
+        q.tryPush( kNormal, 0, 7, 1990 );
+        expectPop( q, 1995, 7, kNormal, __LINE__ );
+        expectPop( q, 1995, 6, kLow, __LINE__ );
+
+        TestQueue::LevelStats low{ q.getStats( kLow ) };
+        // Items 1 and 4 were popped after aging, item 6 wasn't
+        CHECK( low.mPopped == 3 );
+        CHECK( low.mPromoted == 2 );
+    }
+
+    void testMinLevel()
+    {
+        TestQueue q;
+        q.setAgingUs( kLow, 1000 );
+
+        q.tryPush( kLow, 0, 1, 0 );
+        q.tryPush( kNormal, 0, 2, 0 );
+
+        int item;
+        CHECK( !q.tryPop( 0, &item, nullptr, nullptr, kHigh ) );
+
+        // Only the normal item makes the cut until the low one ages
+        expectPop( q, 500, 2, kNormal, __LINE__, kNormal );
+        CHECK( !q.tryPop( 500, &item, nullptr, nullptr, kNormal ) );
+        expectPop( q, 1000, 1, kLow, __LINE__, kNormal );
+    }
+
+    void testStats()
+    {
+        TestQueue q;
+
+        // Each producer has its own queue of capacity 4 on the low level
+        for ( int i = 0; i < 6; ++i )
+        {
+            q.tryPush( kLow, 0, i, 0 );
+        }
+        q.tryPush( kLow, 1, 100, 0 );
+        CHECK( q.isFull( kLow, 0 ) );
+        CHECK( !q.isFull( kLow, 1 ) );
+        CHECK( q.isFull( kLow, 2 ) );    // No such producer
+        CHECK( !q.tryPush( kHigh + 1, 0, 0, 0 ) );
+        CHECK( q.size( kLow ) == 5 );
+
+        TestQueue::LevelStats low{ q.getStats( kLow ) };
+        CHECK( low.mPushed == 5 );
+        CHECK( low.mDropped == 2 );
+        CHECK( low.mHighWater == 4 );
+        CHECK( low.mPopped == 0 );
+        CHECK( low.mPromoted == 0 );
+
+        int item;
+        while ( q.tryPop( 0, &item ) )
+        {
+        }
+        low = q.getStats( kLow );
+        CHECK( low.mPopped == 5 );
+        CHECK( low.mHighWater == 4 );    // High water stays put
+
+        CHECK( q.getStats( kNormal ).mPushed == 0 );
+
+        q.resetStats();
+        low = q.getStats( kLow );
+        CHECK( low.mPushed == 0 && low.mDropped == 0 && low.mPopped == 0
+               && low.mHighWater == 0 );
+
+        q.tryPush( kLow, 0, 1, 0 );
+        q.clear();
+        CHECK( q.isEmpty() );
+    }
+
+}    // namespace
+
+int main()
+{
+    testStrictPriority();
+    testOldestFirstAmongEquals();
+    testAgingPromotesOneLevel();
+    testMinLevel();
+    testStats();
+
+    if ( sFailures )
+    {
+        std::cout << "MultiLevelQueueTest: " << sFailures << " check(s) failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "MultiLevelQueueTest: all checks passed" << std::endl;
+    return 0;
+}
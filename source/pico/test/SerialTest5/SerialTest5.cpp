@@ -100,7 +100,7 @@ int main()
 
         multicore_launch_core1( startCore1 );
 
-        SerialMessageProcessor smp( 32, rpi0 );
+        SerialMessageProcessor smp( rpi0 );
         smp.registerMessage<TimerControlMsg>( MsgId::kTimerControl );
         smp.registerMessage<DebugLinkMsg>( MsgId::kDebugSerialLink );
 
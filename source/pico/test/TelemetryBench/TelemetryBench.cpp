@@ -0,0 +1,119 @@
+/*
+    TelemetryBench.cpp - Compare the per-nav-tick cost of converting BNO055
+    and ADC readings to float on the Pico (software floating point) against
+    sending them raw.
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <hardware/clocks.h>
+#include <hardware/timer.h>
+#include <pico/stdlib.h>
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+#include "TelemetryUnits.h"
+
+namespace
+{
+    constexpr int kNbrTicks{ 100'000 };
+
+    // Volatile so the compiler can't fold the conversions away
+    volatile std::int16_t sRawHeading{ 2881 };
+    volatile std::uint16_t sRawIcBattery{ 2'700 };
+    volatile std::uint16_t sRawMotorBattery{ 1'650 };
+
+    // Stands in for the serial link: the bytes a nav tick puts on the wire
+    std::array<std::uint8_t, 16> sWire{};
+    volatile std::uint8_t sSink{};
+
+    template<typename T>
+    std::size_t put( std::size_t at, T value )
+    {
+        auto bytes{ std::bit_cast<std::array<std::uint8_t, sizeof( T )>>( value ) };
+        std::memcpy( sWire.data() + at, bytes.data(), bytes.size() );
+        return at + bytes.size();
+    }
+
+    // What the Pico did before: heading and both battery voltages as float
+    std::uint32_t runFloatPath()
+    {
+        std::uint32_t start{ time_us_32() };
+
+        for ( int i = 0; i < kNbrTicks; ++i )
+        {
+            float heading{ TelemetryUnits::rawAngleToDegrees( sRawHeading ) };
+            float icVolts{ TelemetryUnits::rawIcBatteryToVolts( sRawIcBattery ) };
+            float motorVolts{ TelemetryUnits::rawMotorBatteryToVolts( sRawMotorBattery ) };
+
+            std::size_t at{ put( 0, heading ) };
+            at = put( at, icVolts );
+            put( at, motorVolts );
+            sSink = sWire[ 0 ];
+        }
+
+        return time_us_32() - start;
+    }
+
+    // What the Pico does now: raw sensor units straight onto the wire
+    std::uint32_t runRawPath()
+    {
+        std::uint32_t start{ time_us_32() };
+
+        for ( int i = 0; i < kNbrTicks; ++i )
+        {
+            std::size_t at{ put( 0, static_cast<std::int16_t>( sRawHeading ) ) };
+            at = put( at, static_cast<std::uint16_t>( sRawIcBattery ) );
+            put( at, static_cast<std::uint16_t>( sRawMotorBattery ) );
+            sSink = sWire[ 0 ];
+        }
+
+        return time_us_32() - start;
+    }
+
+    void report( const char* label, std::uint32_t elapsedUs )
+    {
+        std::uint32_t mhz{ clock_get_hz( clk_sys ) / 1'000'000 };
+        std::cout << label << ": " << elapsedUs << " us total, "
+                  << ( static_cast<std::uint64_t>( elapsedUs ) * mhz ) / kNbrTicks
+                  << " cycles/tick" << std::endl;
+    }
+
+}    // namespace
+
+int main()
+{
+    stdio_init_all();
+
+    sleep_ms( 2000 );
+
+    std::cout << "Telemetry benchmark: " << kNbrTicks << " nav ticks at "
+              << clock_get_hz( clk_sys ) / 1'000'000 << " MHz" << std::endl;
+
+    while ( true )
+    {
+        report( "float path", runFloatPath() );
+        report( "raw path  ", runRawPath() );
+
+        sleep_ms( 5000 );
+    }
+
+    return 0;
+}
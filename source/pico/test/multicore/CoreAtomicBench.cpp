@@ -0,0 +1,140 @@
+// Measure CAtomic with both cores hammering on it: lock-free loads, and
+// fetch_add on separate (differently striped) and on the same atomic,
+// against one critical section shared by everything (how CAtomic used to
+// work)
+
+#include <hardware/timer.h>
+#include <pico/critical_section.h>
+#include <pico/multicore.h>
+#include <pico/stdlib.h>
+
+#include <cstdint>
+#include <iostream>
+
+#include "CoreAtomic.hpp"
+
+namespace
+{
+    constexpr int kNbrOps{ 200'000 };
+
+    enum Test : std::uint32_t
+    {
+        kLoads,             // CAtomic::load(), own variable
+        kLoadsOneLock,      // Load under the one shared lock, own variable
+        kAddSeparate,       // CAtomic::fetch_add(), own variable
+        kAddSame,           // CAtomic::fetch_add(), both on one variable
+        kAddOneLock         // Add under the one shared lock, own variable
+    };
+
+    // Adjacent, so on different stripes
+    CoreAtomic::CAtomic<std::uint32_t> sCounters[ 2 ];
+
+    critical_section_t sOneLock;
+    volatile std::uint32_t sOneLockCounters[ 2 ];
+
+    volatile std::uint32_t sSink;
+
+    // Returns elapsed us
+    std::uint32_t runTest( Test test, int core )
+    {
+        std::uint32_t sum{ 0 };
+        std::uint32_t start{ time_us_32() };
+
+        for ( int i = 0; i < kNbrOps; ++i )
+        {
+            switch ( test )
+            {
+                case kLoads:
+                    sum += sCounters[ core ].load();
+                    break;
+
+                case kLoadsOneLock:
+                    critical_section_enter_blocking( &sOneLock );
+                    sum += sOneLockCounters[ core ];
+                    critical_section_exit( &sOneLock );
+                    break;
+
+                case kAddSeparate:
+                    sCounters[ core ].fetch_add( 1 );
+                    break;
+
+                case kAddSame:
+                    sCounters[ 0 ].fetch_add( 1 );
+                    break;
+
+                case kAddOneLock:
+                    critical_section_enter_blocking( &sOneLock );
+                    sOneLockCounters[ core ] = sOneLockCounters[ core ] + 1;
+                    critical_section_exit( &sOneLock );
+                    break;
+            }
+        }
+
+        std::uint32_t elapsed{ time_us_32() - start };
+        sSink = sum;
+        return elapsed;
+    }
+
+    void core1Main()
+    {
+        while ( true )
+        {
+            auto test{ static_cast<Test>( multicore_fifo_pop_blocking() ) };
+            multicore_fifo_push_blocking( runTest( test, 1 ) );
+        }
+    }
+
+    void runBothCores( const char* label, Test test, std::uint32_t expectedCount )
+    {
+        sCounters[ 0 ] = 0;
+        sCounters[ 1 ] = 0;
+        sOneLockCounters[ 0 ] = 0;
+        sOneLockCounters[ 1 ] = 0;
+
+        multicore_fifo_push_blocking( test );
+        std::uint32_t core0Us{ runTest( test, 0 ) };
+        std::uint32_t core1Us{ multicore_fifo_pop_blocking() };
+
+        std::cout << label << ": Core0 " << ( core0Us * 1000 ) / kNbrOps << " ns/op, Core1 "
+                  << ( core1Us * 1000 ) / kNbrOps << " ns/op";
+
+        // Lost updates would mean the atomics aren't
+        std::uint32_t count{ sCounters[ 0 ].load() + sCounters[ 1 ].load() + sOneLockCounters[ 0 ]
+                             + sOneLockCounters[ 1 ] };
+        if ( count != expectedCount )
+        {
+            std::cout << " FAILED (count " << count << ", expected " << expectedCount << ")";
+        }
+        std::cout << std::endl;
+    }
+
+}    // namespace
+
+int main()
+{
+    stdio_init_all();
+
+    CoreAtomic::CAtomicInitializer theInitializationIsDone;
+    critical_section_init( &sOneLock );
+
+    sleep_ms( 2000 );
+
+    std::cout << "CoreAtomic benchmark: " << kNbrOps << " ops on each core; 32-bit load "
+              << ( sCounters[ 0 ].is_load_lock_free() ? "is" : "is not" )
+              << " lock-free" << std::endl;
+
+    multicore_launch_core1( core1Main );
+
+    while ( true )
+    {
+        runBothCores( "load, CAtomic             ", kLoads, 0 );
+        runBothCores( "load, one shared lock     ", kLoadsOneLock, 0 );
+        runBothCores( "fetch_add, CAtomic, own   ", kAddSeparate, 2 * kNbrOps );
+        runBothCores( "fetch_add, CAtomic, same  ", kAddSame, 2 * kNbrOps );
+        runBothCores( "add, one shared lock      ", kAddOneLock, 2 * kNbrOps );
+
+        sleep_ms( 5000 );
+    }
+
+    return 0;
+}
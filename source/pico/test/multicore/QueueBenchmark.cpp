@@ -0,0 +1,155 @@
+// Compare the Pico SDK queue_t against SpscQueue for passing
+// EventManager-sized items from Core1 to Core0
+
+#include <hardware/sync.h>
+#include <hardware/timer.h>
+#include <pico/multicore.h>
+#include <pico/stdlib.h>
+#include <pico/util/queue.h>
+
+#include <cstdint>
+#include <iostream>
+
+#include "SpscQueue.hpp"
+
+namespace
+{
+    struct Item
+    {
+        int mCode;
+        int mParam;
+        std::uint32_t mTime;
+    };
+
+    constexpr int kQueueSize{ 32 };
+    constexpr int kNbrItems{ 100'000 };
+
+    queue_t sSdkQueue;
+    SpscQueue<Item, kQueueSize> sSpscQueue;
+
+    volatile bool sUseSpsc{ false };
+
+    void core1Producer()
+    {
+        while ( true )
+        {
+            // Wait for Core0 to say "go"
+            multicore_fifo_pop_blocking();
+
+            for ( int i = 0; i < kNbrItems; ++i )
+            {
+                Item item{ i, -i, static_cast<std::uint32_t>( i ) };
+                if ( sUseSpsc )
+                {
+                    while ( !sSpscQueue.tryPush( item ) )
+                    {
+                        tight_loop_contents();
+                    }
+                }
+                else
+                {
+                    queue_add_blocking( &sSdkQueue, &item );
+                }
+            }
+        }
+    }
+
+    // Returns elapsed us, or 0 if an item arrived out of order
+    std::uint32_t runCrossCore( bool useSpsc )
+    {
+        sUseSpsc = useSpsc;
+
+        std::uint32_t start{ time_us_32() };
+        multicore_fifo_push_blocking( 1 );
+
+        for ( int i = 0; i < kNbrItems; ++i )
+        {
+            Item item{};
+            if ( useSpsc )
+            {
+                while ( !sSpscQueue.tryPop( &item ) )
+                {
+                    tight_loop_contents();
+                }
+            }
+            else
+            {
+                queue_remove_blocking( &sSdkQueue, &item );
+            }
+
+            if ( item.mCode != i )
+            {
+                return 0;
+            }
+        }
+
+        return time_us_32() - start;
+    }
+
+    // Push then pop on one core: the fixed cost per item with no contention
+    std::uint32_t runSingleCore( bool useSpsc )
+    {
+        std::uint32_t start{ time_us_32() };
+
+        for ( int i = 0; i < kNbrItems; ++i )
+        {
+            Item item{ i, -i, static_cast<std::uint32_t>( i ) };
+            if ( useSpsc )
+            {
+                sSpscQueue.tryPush( item );
+                sSpscQueue.tryPop( &item );
+            }
+            else
+            {
+                queue_try_add( &sSdkQueue, &item );
+                queue_try_remove( &sSdkQueue, &item );
+            }
+        }
+
+        return time_us_32() - start;
+    }
+
+    void report( const char* label, std::uint32_t elapsedUs )
+    {
+        std::cout << label << ": ";
+        if ( elapsedUs == 0 )
+        {
+            std::cout << "FAILED (items out of order)" << std::endl;
+        }
+        else
+        {
+            std::cout << elapsedUs << " us total, "
+                      << ( elapsedUs * 1000 ) / kNbrItems << " ns/item"
+                      << std::endl;
+        }
+    }
+
+}    // namespace
+
+int main()
+{
+    stdio_init_all();
+
+    sleep_ms( 2000 );
+
+    std::cout << "Queue benchmark: " << kNbrItems << " items of "
+              << sizeof( Item ) << " bytes, queue size " << kQueueSize
+              << std::endl;
+
+    queue_init( &sSdkQueue, sizeof( Item ), kQueueSize );
+
+    report( "queue_t   single core", runSingleCore( false ) );
+    report( "SpscQueue single core", runSingleCore( true ) );
+
+    multicore_launch_core1( core1Producer );
+
+    while ( true )
+    {
+        report( "queue_t   Core1->Core0", runCrossCore( false ) );
+        report( "SpscQueue Core1->Core0", runCrossCore( true ) );
+
+        sleep_ms( 5000 );
+    }
+
+    return 0;
+}
@@ -1,6 +1,7 @@
 /*
-    CoreAtomic.hpp - A template for an Atomic class that is atomic across cores
-    and uses only one critical_section spinlock shared across all instances.
+    CoreAtomic.hpp - A template for an Atomic class that is atomic across cores.
+    Word-sized loads are lock-free; everything else (stores included) takes
+    one of a few critical_section spinlocks, picked by the variable's address.
 
     Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
 
@@ -34,24 +35,36 @@ namespace CoreAtomic
 
     namespace Internal
     {
-        // A critical section shared by all atomic variable instances
-        inline critical_section_t mCritSec{};
+        // Critical sections shared by all atomic variable instances; the
+        // SDK gives each its own hardware spinlock (from the striped ones),
+        // so atomics on different stripes don't contend
+        constexpr int kNbrLockStripes{ 4 };
+        inline critical_section_t mCritSecs[ kNbrLockStripes ]{};
 
     }    // namespace Internal
 
-    // Call this function to init the shared critical section
+    // Call this function to init the shared critical sections
     // Notionally called at the beginning of main()
-    inline void initCAtomic() { critical_section_init( &Internal::mCritSec ); }
+    inline void initCAtomic()
+    {
+        for ( auto& critSec : Internal::mCritSecs )
+        {
+            critical_section_init( &critSec );
+        }
+    }
 
-    // Call this to de-init the shared critical section
+    // Call this to de-init the shared critical sections
     // Notionally called at the end of main()
     inline void deinitCAtomic()
     {
-        critical_section_deinit( &Internal::mCritSec );
+        for ( auto& critSec : Internal::mCritSecs )
+        {
+            critical_section_deinit( &critSec );
+        }
     }
 
     // Helper class for initializing and deinitializing the
-    // shared critical section
+    // shared critical sections
     class CAtomicInitializer
     {
     public:
@@ -92,44 +105,28 @@ namespace CoreAtomic
             return *this;
         }
 
-        // is_lock_free()
-        bool is_lock_free() const noexcept { return false; }
+        // is_lock_free(): the read-modify-write operations always take a
+        // lock (the M0+ has no exclusive load/store), so never lock-free as
+        // std::atomic means it.  Stores take the same lock, or one landing
+        // in the middle of another core's read-modify-write would be lost;
+        // only loads can skip it (is_load_lock_free()).
+        bool is_lock_free() const noexcept { return is_always_lock_free; }
 
-        bool is_lock_free() const volatile noexcept { return false; }
+        bool is_lock_free() const volatile noexcept { return is_always_lock_free; }
+
+        bool is_load_lock_free() const noexcept { return kLockFreeLoad; }
+
+        bool is_load_lock_free() const volatile noexcept { return kLockFreeLoad; }
 
         // store()
-        void store( T value ) noexcept
-        {
-            CriticalSection block( mCritSec );
-            mValue = value;
-        }
+        void store( T value ) noexcept { storeValue( value ); }
 
-        void store( T value ) volatile noexcept
-        {
-            CriticalSection block( mCritSec );
-            mValue = value;
-        }
+        void store( T value ) volatile noexcept { storeValue( value ); }
 
         // load()
-        T load() const noexcept
-        {
-            T ret{};
-            {
-                CriticalSection block( mCritSec );
-                ret = mValue;
-            }
-            return ret;
-        }
+        T load() const noexcept { return loadValue(); }
 
-        T load() const volatile noexcept
-        {
-            T ret{};
-            {
-                CriticalSection block( mCritSec );
-                ret = mValue;
-            }
-            return ret;
-        }
+        T load() const volatile noexcept { return loadValue(); }
 
         // operator T()
         operator T() const noexcept { return load(); }
@@ -141,7 +138,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 ret = mValue;
                 mValue = in;
             }
@@ -152,7 +149,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 ret = mValue;
                 mValue = in;
             }
@@ -164,7 +161,7 @@ namespace CoreAtomic
         {
             bool ret{ false };
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 if ( mValue == expected )
                 {
                     mValue = newValue;
@@ -182,7 +179,7 @@ namespace CoreAtomic
         {
             bool ret{ false };
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 if ( mValue == expected )
                 {
                     mValue = newValue;
@@ -222,7 +219,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 ret = mValue;
                 mValue += arg;
             }
@@ -233,7 +230,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 ret = mValue;
                 mValue += arg;
             }
@@ -245,7 +242,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 ret = mValue;
                 mValue -= arg;
             }
@@ -256,7 +253,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 ret = mValue;
                 mValue -= arg;
             }
@@ -268,7 +265,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 mValue += arg;
                 ret = mValue;
             }
@@ -279,7 +276,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 mValue += arg;
                 ret = mValue;
             }
@@ -291,7 +288,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 mValue -= arg;
                 ret = mValue;
             }
@@ -302,7 +299,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 mValue -= arg;
                 ret = mValue;
             }
@@ -314,7 +311,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 // ++mValue/mValue++ trigger gcc warnings on volatile mValue
                 mValue += 1;
                 ret = mValue;
@@ -326,7 +323,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 // ++mValue/mValue++ trigger gcc warnings on volatile mValue
                 mValue += 1;
                 ret = mValue;
@@ -339,7 +336,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 // ++mValue/mValue++ trigger gcc warnings on volatile mValue
                 ret = mValue;
                 mValue += 1;
@@ -351,7 +348,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 // ++mValue/mValue++ trigger gcc warnings on volatile mValue
                 ret = mValue;
                 mValue += 1;
@@ -364,7 +361,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 // --mValue/mValue-- trigger gcc warnings on volatile mValue
                 mValue -= 1;
                 ret = mValue;
@@ -376,7 +373,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 // --mValue/mValue-- trigger gcc warnings on volatile mValue
                 mValue -= 1;
                 ret = mValue;
@@ -389,7 +386,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 // --mValue/mValue-- trigger gcc warnings on volatile mValue
                 ret = mValue;
                 mValue -= 1;
@@ -401,7 +398,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 // --mValue/mValue-- trigger gcc warnings on volatile mValue
                 ret = mValue;
                 mValue -= 1;
@@ -414,7 +411,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 ret = mValue;
                 mValue &= arg;
             }
@@ -425,7 +422,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 ret = mValue;
                 mValue &= arg;
             }
@@ -437,7 +434,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 ret = mValue;
                 mValue |= arg;
             }
@@ -448,7 +445,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 ret = mValue;
                 mValue |= arg;
             }
@@ -460,7 +457,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 ret = mValue;
                 mValue ^= arg;
             }
@@ -471,7 +468,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 ret = mValue;
                 mValue ^= arg;
             }
@@ -483,7 +480,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 mValue &= arg;
                 ret = mValue;
             }
@@ -494,7 +491,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 mValue &= arg;
                 ret = mValue;
             }
@@ -506,7 +503,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 mValue |= arg;
                 ret = mValue;
             }
@@ -517,7 +514,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 mValue |= arg;
                 ret = mValue;
             }
@@ -529,7 +526,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 mValue ^= arg;
                 ret = mValue;
             }
@@ -540,7 +537,7 @@ namespace CoreAtomic
         {
             T ret{};
             {
-                CriticalSection block( mCritSec );
+                CriticalSection block( critSec() );
                 mValue ^= arg;
                 ret = mValue;
             }
@@ -551,7 +548,41 @@ namespace CoreAtomic
         static constexpr bool is_always_lock_free = false;
 
     private:
-        inline static critical_section_t& mCritSec{ Internal::mCritSec };
+        // Aligned loads of a word or less are single instructions on the
+        // M0+, so they can't see a store (or read-modify-write) half done
+        static constexpr bool kLockFreeLoad{ sizeof( T ) <= sizeof( std::uint32_t ) };
+
+        // Adjacent words (e.g., an array of CAtomics) land on different stripes
+        critical_section_t& critSec() const volatile noexcept
+        {
+            auto addr{ reinterpret_cast<std::uintptr_t>( &mValue ) };
+            return Internal::mCritSecs[ ( addr >> 2 ) % Internal::kNbrLockStripes ];
+        }
+
+        void storeValue( T value ) volatile noexcept
+        {
+            // Under the lock even for a word: a plain store could fall
+            // between another core's read and write in fetch_add() etc.
+            CriticalSection block( critSec() );
+            mValue = value;
+        }
+
+        T loadValue() const volatile noexcept
+        {
+            T ret{};
+            if constexpr ( kLockFreeLoad )
+            {
+                ret = mValue;
+                __dmb();
+            }
+            else
+            {
+                CriticalSection block( critSec() );
+                ret = mValue;
+            }
+            return ret;
+        }
+
         volatile T mValue;
 
     };    // struct CAtomic
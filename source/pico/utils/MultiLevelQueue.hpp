@@ -0,0 +1,369 @@
+/*
+    MultiLevelQueue.hpp - A set of lock-free priority queues, one group of
+    single-producer, single-consumer queues per priority level, with optional
+    aging of waiting items and per-level statistics.
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MultiLevelQueue_hpp
+#define MultiLevelQueue_hpp
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+#include "SpscQueue.hpp"
+
+// A snapshot of one level's statistics; counts run freely and wrap at 2^32
+struct MultiLevelQueueStats
+{
+    std::uint32_t mPushed;
+    std::uint32_t mDropped;      // Pushes refused because a queue was full
+    std::uint32_t mPopped;
+    std::uint32_t mPromoted;     // Pops won thanks to aging
+    std::uint32_t mHighWater;    // Most items seen in one queue at once
+};
+
+// Level 0 is the lowest priority; Capacities lists the capacity of each
+// level's queues from lowest to highest (each a power of 2).  Every level
+// has one SpscQueue per producer context (e.g., one per core), so the
+// usual SpscQueue rules apply: exactly one context pushes with a given
+// producer index, and exactly one context pops.
+//
+// tryPop() takes the item at the head of any queue with the highest
+// *effective* level, oldest first among equals.  An item's effective level
+// is its own level, or the level above once it has waited at least that
+// level's aging time (if any).  Aging only ever promotes by one level, so
+// a starving low-priority item can compete with the level above but never
+// jumps ahead of the top level.
+//
+// Time is supplied by the caller (any free-running 32-bit microsecond
+// count), so nothing here touches the hardware and it can be unit tested
+// on a host.
+template<typename T, std::size_t NbrProducers, std::size_t... Capacities>
+class MultiLevelQueue
+{
+    static_assert( NbrProducers > 0, "MultiLevelQueue needs a producer" );
+    static_assert( sizeof...( Capacities ) > 0,
+                   "MultiLevelQueue needs at least one level" );
+
+public:
+    static constexpr std::size_t kNbrLevels{ sizeof...( Capacities ) };
+    static constexpr std::size_t kNbrProducers{ NbrProducers };
+
+    using LevelStats = MultiLevelQueueStats;
+
+    constexpr MultiLevelQueue() noexcept = default;
+
+    // Prevent copy and move
+    MultiLevelQueue( const MultiLevelQueue& ) = delete;
+    MultiLevelQueue& operator=( const MultiLevelQueue& ) = delete;
+    MultiLevelQueue( MultiLevelQueue&& ) = delete;
+    MultiLevelQueue& operator=( MultiLevelQueue&& ) = delete;
+
+    static constexpr std::size_t capacity( std::size_t level ) noexcept
+    {
+        constexpr std::size_t kCapacities[]{ Capacities... };
+        return level < kNbrLevels ? kCapacities[ level ] : 0;
+    }
+
+    // Producer side only: returns false if the queue is full (or the level
+    // or producer is out of range)
+    bool tryPush( std::size_t level, std::size_t producer, const T& item,
+                  std::uint32_t nowUs ) noexcept
+    {
+        if ( level >= kNbrLevels || producer >= kNbrProducers )
+        {
+            return false;
+        }
+
+        ProducerCounts& counts{ mProducerCounts[ level ][ producer ] };
+        bool success{ false };
+        std::size_t size{ 0 };
+        forLevel( level, [&]( auto& queues ) {
+            auto& q{ queues[ producer ] };
+            success = q.tryPush( Entry{ item, nowUs } );
+            size = q.size();
+        } );
+
+        bump( success ? counts.mPushed : counts.mDropped );
+        if ( size > counts.mHighWater.loadRelaxed() )
+        {
+            counts.mHighWater.storeRelease( static_cast<std::uint32_t>( size ) );
+        }
+
+        return success;
+    }
+
+    // Consumer side only: takes the next item whose effective level is at
+    // least minLevel; returns false if there is none.  queuedAtUs and level
+    // (if requested) get the time the item was pushed and its own level.
+    bool tryPop( std::uint32_t nowUs, T* item,
+                 std::uint32_t* queuedAtUs = nullptr,
+                 std::size_t* level = nullptr,
+                 std::size_t minLevel = 0 ) noexcept
+    {
+        Pick best{};
+
+        forEachLevel( [&]( std::size_t lvl, auto& queues ) {
+            for ( std::size_t p = 0; p < kNbrProducers; ++p )
+            {
+                Entry e;
+                if ( !queues[ p ].peek( &e ) )
+                {
+                    continue;
+                }
+
+                // A producer on the other core may have stamped its item
+                // a little after the caller read nowUs
+                std::int32_t age{ static_cast<std::int32_t>( nowUs - e.mQueuedAt ) };
+                if ( age < 0 )
+                {
+                    age = 0;
+                }
+
+                std::size_t effective{ lvl };
+                if ( lvl + 1 < kNbrLevels && mAgingUs[ lvl ] > 0
+                     && static_cast<std::uint32_t>( age ) >= mAgingUs[ lvl ] )
+                {
+                    effective = lvl + 1;
+                }
+
+                if ( effective >= minLevel
+                     && ( !best.mFound || effective > best.mEffective
+                          || ( effective == best.mEffective && age > best.mAge ) ) )
+                {
+                    best = { true, lvl, p, effective, age };
+                }
+            }
+        } );
+
+        if ( !best.mFound )
+        {
+            return false;
+        }
+
+        Entry e;
+        forLevel( best.mLevel,
+                  [&]( auto& queues ) { queues[ best.mProducer ].tryPop( &e ); } );
+
+        *item = e.mItem;
+        if ( queuedAtUs )
+        {
+            *queuedAtUs = e.mQueuedAt;
+        }
+        if ( level )
+        {
+            *level = best.mLevel;
+        }
+
+        ConsumerCounts& counts{ mConsumerCounts[ best.mLevel ] };
+        ++counts.mPopped;
+        if ( best.mEffective > best.mLevel )
+        {
+            ++counts.mPromoted;
+        }
+
+        return true;
+    }
+
+    // Consumer side only: items on this level that have waited at least
+    // agingUs compete with the level above; 0 (the default) turns aging
+    // off.  The top level has nowhere to go, so setting it does nothing.
+    void setAgingUs( std::size_t level, std::uint32_t agingUs ) noexcept
+    {
+        if ( level + 1 < kNbrLevels )
+        {
+            mAgingUs[ level ] = agingUs;
+        }
+    }
+
+    std::uint32_t getAgingUs( std::size_t level ) const noexcept
+    {
+        return level < kNbrLevels ? mAgingUs[ level ] : 0;
+    }
+
+    // Consumer side only: discard everything currently queued
+    void clear() noexcept
+    {
+        forEachLevel( [&]( std::size_t, auto& queues ) {
+            for ( auto& q : queues )
+            {
+                q.clear();
+            }
+        } );
+    }
+
+    // These can be called from either side, but the answers are only
+    // snapshots: the other side may change them immediately afterwards
+    std::size_t size( std::size_t level ) const noexcept
+    {
+        std::size_t n{ 0 };
+        forLevel( level, [&]( const auto& queues ) {
+            for ( const auto& q : queues )
+            {
+                n += q.size();
+            }
+        } );
+        return n;
+    }
+
+    bool isEmpty( std::size_t level ) const noexcept
+    {
+        return size( level ) == 0;
+    }
+
+    bool isEmpty() const noexcept
+    {
+        for ( std::size_t lvl = 0; lvl < kNbrLevels; ++lvl )
+        {
+            if ( !isEmpty( lvl ) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool isFull( std::size_t level, std::size_t producer ) const noexcept
+    {
+        bool full{ true };
+        if ( producer < kNbrProducers )
+        {
+            forLevel( level, [&]( const auto& queues ) {
+                full = queues[ producer ].isFull();
+            } );
+        }
+        return full;
+    }
+
+    // Either side; producers can keep counting while this is summed
+    LevelStats getStats( std::size_t level ) const noexcept
+    {
+        LevelStats stats{};
+        if ( level >= kNbrLevels )
+        {
+            return stats;
+        }
+
+        for ( const ProducerCounts& counts : mProducerCounts[ level ] )
+        {
+            stats.mPushed += counts.mPushed.loadAcquire();
+            stats.mDropped += counts.mDropped.loadAcquire();
+            std::uint32_t highWater{ counts.mHighWater.loadAcquire() };
+            if ( highWater > stats.mHighWater )
+            {
+                stats.mHighWater = highWater;
+            }
+        }
+
+        stats.mPopped = mConsumerCounts[ level ].mPopped;
+        stats.mPromoted = mConsumerCounts[ level ].mPromoted;
+        return stats;
+    }
+
+    // Consumer side only.  Each producer counter has a single writer, so
+    // zeroing one from here can lose a count or two if that producer is
+    // pushing at the same moment; fine for statistics.
+    void resetStats() noexcept
+    {
+        for ( std::size_t lvl = 0; lvl < kNbrLevels; ++lvl )
+        {
+            for ( ProducerCounts& counts : mProducerCounts[ lvl ] )
+            {
+                counts.mPushed.storeRelease( 0 );
+                counts.mDropped.storeRelease( 0 );
+                counts.mHighWater.storeRelease( 0 );
+            }
+            mConsumerCounts[ lvl ] = {};
+        }
+    }
+
+private:
+    struct Entry
+    {
+        T mItem;
+        std::uint32_t mQueuedAt;
+    };
+
+    struct Pick
+    {
+        bool mFound;
+        std::size_t mLevel;
+        std::size_t mProducer;
+        std::size_t mEffective;
+        std::int32_t mAge;
+    };
+
+    // Written only by the producer that owns them
+    struct ProducerCounts
+    {
+        SpscInternal::Index mPushed;
+        SpscInternal::Index mDropped;
+        SpscInternal::Index mHighWater;
+    };
+
+    // Written only by the consumer
+    struct ConsumerCounts
+    {
+        std::uint32_t mPopped;
+        std::uint32_t mPromoted;
+    };
+
+    template<std::size_t Capacity>
+    using LevelQueues = std::array<SpscQueue<Entry, Capacity>, NbrProducers>;
+
+    static void bump( SpscInternal::Index& counter ) noexcept
+    {
+        counter.storeRelease( counter.loadRelaxed() + 1 );
+    }
+
+    // The levels have different capacities (hence types), so a runtime
+    // level index is mapped onto the tuple element by folding over them
+    template<typename F>
+    void forEachLevel( F&& f ) noexcept
+    {
+        [&]<std::size_t... I>( std::index_sequence<I...> ) {
+            ( f( I, std::get<I>( mLevels ) ), ... );
+        }( std::make_index_sequence<kNbrLevels>{} );
+    }
+
+    template<typename F>
+    void forLevel( std::size_t level, F&& f ) noexcept
+    {
+        [&]<std::size_t... I>( std::index_sequence<I...> ) {
+            ( void )( ( I == level && ( f( std::get<I>( mLevels ) ), true ) ) || ... );
+        }( std::make_index_sequence<kNbrLevels>{} );
+    }
+
+    template<typename F>
+    void forLevel( std::size_t level, F&& f ) const noexcept
+    {
+        [&]<std::size_t... I>( std::index_sequence<I...> ) {
+            ( void )( ( I == level && ( f( std::get<I>( mLevels ) ), true ) ) || ... );
+        }( std::make_index_sequence<kNbrLevels>{} );
+    }
+
+    std::tuple<LevelQueues<Capacities>...> mLevels{};
+    ProducerCounts mProducerCounts[ kNbrLevels ][ NbrProducers ]{};
+    ConsumerCounts mConsumerCounts[ kNbrLevels ]{};
+    std::uint32_t mAgingUs[ kNbrLevels ]{};
+};
+
+#endif    // MultiLevelQueue_hpp
@@ -0,0 +1,129 @@
+/*
+    Seqlock.hpp - A lock-free "latest value" cell: one writer publishes
+    snapshots that readers on either core copy out without ever blocking
+    the writer.
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef Seqlock_hpp
+#define Seqlock_hpp
+
+#include <cstdint>
+#include <type_traits>
+
+#if BUILDING_FOR_PICO
+    #include <hardware/sync.h>
+#else
+    #include <atomic>
+#endif
+
+#include "SpscQueue.hpp"
+
+namespace SeqlockInternal
+{
+
+#if BUILDING_FOR_PICO
+
+    inline void fence() noexcept { __dmb(); }
+
+#else
+
+    inline void fence() noexcept { std::atomic_thread_fence( std::memory_order_seq_cst ); }
+
+#endif    // BUILDING_FOR_PICO
+
+}    // namespace SeqlockInternal
+
+// Holds the most recent value written; unlike a queue, a new write simply
+// replaces the old value, so the writer never waits on (or even knows about)
+// its readers.
+//
+// The sequence is odd while a write is in progress and goes up by 2 for
+// each write.  A reader copies the value between two reads of the sequence
+// and keeps the copy only if the sequence was even and didn't change, so it
+// never sees a half-written value.  Reads take a copy of T plus a couple of
+// loads unless they race the writer, in which case they try again.
+//
+// There must be exactly ONE writer context, and a reader must never
+// interrupt the writer on the same core (it would spin forever); readers on
+// the other core are always fine.
+template<typename T>
+class Seqlock
+{
+    static_assert( std::is_trivially_copyable_v<T>, "Seqlock values must be trivially copyable" );
+
+public:
+    using value_type = T;
+
+    constexpr Seqlock() noexcept : mValue{}, mSequence{} {}
+
+    // Prevent copy and move
+    Seqlock( const Seqlock& ) = delete;
+    Seqlock& operator=( const Seqlock& ) = delete;
+    Seqlock( Seqlock&& ) = delete;
+    Seqlock& operator=( Seqlock&& ) = delete;
+
+    // Writer only
+    void write( const T& value ) noexcept
+    {
+        std::uint32_t seq{ mSequence.loadRelaxed() };
+
+        mSequence.storeRelease( seq + 1 );
+        SeqlockInternal::fence();
+
+        mValue = value;
+
+        mSequence.storeRelease( seq + 2 );
+    }
+
+    // Any context (see above): copies the latest value into *value and
+    // returns how many writes there have been; returns 0 (and leaves
+    // *value alone) if nothing has been written yet
+    std::uint32_t read( T* value ) const noexcept
+    {
+        while ( true )
+        {
+            std::uint32_t before{ mSequence.loadAcquire() };
+            if ( before == 0 )
+            {
+                return 0;
+            }
+
+            if ( ( before & 1 ) == 0 )
+            {
+                T copy{ mValue };
+                SeqlockInternal::fence();
+
+                if ( mSequence.loadRelaxed() == before )
+                {
+                    *value = copy;
+                    return before / 2;
+                }
+            }
+        }
+    }
+
+    // Any context: how many writes there have been (cheaper than read()
+    // for checking whether there is anything new)
+    std::uint32_t writes() const noexcept { return mSequence.loadAcquire() / 2; }
+
+private:
+    T mValue;
+    SpscInternal::Index mSequence;
+};
+
+#endif    // Seqlock_hpp
@@ -0,0 +1,195 @@
+/*
+    SpscQueue.hpp - A lock-free single-producer, single-consumer ring buffer
+    for passing fixed-size items between the two Pico cores (or between
+    an interrupt handler and thread code on the same core).
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SpscQueue_hpp
+#define SpscQueue_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if BUILDING_FOR_PICO
+    #include <hardware/sync.h>
+#else
+    #include <atomic>
+#endif
+
+namespace SpscInternal
+{
+
+#if BUILDING_FOR_PICO
+
+    // On the RP2040, aligned 32-bit loads and stores are single-copy atomic
+    // and the Cortex-M0+ has no caches, so a volatile word plus explicit
+    // data memory barriers is all that is needed to publish an index
+    class Index
+    {
+    public:
+        constexpr Index() noexcept : mValue{ 0 } {}
+
+        std::uint32_t loadRelaxed() const noexcept { return mValue; }
+
+        std::uint32_t loadAcquire() const noexcept
+        {
+            std::uint32_t value{ mValue };
+            __dmb();
+            return value;
+        }
+
+        void storeRelease( std::uint32_t value ) noexcept
+        {
+            __dmb();
+            mValue = value;
+        }
+
+    private:
+        volatile std::uint32_t mValue;
+    };
+
+#else
+
+    // Off the Pico (e.g., unit testing on a host) use std::atomic
+    class Index
+    {
+    public:
+        constexpr Index() noexcept : mValue{ 0 } {}
+
+        std::uint32_t loadRelaxed() const noexcept
+        {
+            return mValue.load( std::memory_order_relaxed );
+        }
+
+        std::uint32_t loadAcquire() const noexcept
+        {
+            return mValue.load( std::memory_order_acquire );
+        }
+
+        void storeRelease( std::uint32_t value ) noexcept
+        {
+            mValue.store( value, std::memory_order_release );
+        }
+
+    private:
+        std::atomic<std::uint32_t> mValue;
+    };
+
+#endif    // BUILDING_FOR_PICO
+
+}    // namespace SpscInternal
+
+// A fixed-capacity FIFO that is safe without any locks provided there
+// is exactly ONE producer context and exactly ONE consumer context.
+//
+// The write index is only ever written by the producer and the read index
+// only by the consumer; each side publishes its index with a barrier after
+// (producer) or before (consumer) touching the slot.  Indices run freely
+// and wrap at 2^32, which is why the capacity must be a power of two.
+template<typename T, std::size_t N>
+class SpscQueue
+{
+    static_assert( N > 0 && ( N & ( N - 1 ) ) == 0,
+                   "SpscQueue capacity must be a power of 2" );
+    static_assert( std::is_trivially_copyable_v<T>,
+                   "SpscQueue items must be trivially copyable" );
+
+public:
+    using value_type = T;
+
+    constexpr SpscQueue() noexcept : mBuffer{}, mWriteIndex{}, mReadIndex{} {}
+
+    // Prevent copy and move
+    SpscQueue( const SpscQueue& ) = delete;
+    SpscQueue& operator=( const SpscQueue& ) = delete;
+    SpscQueue( SpscQueue&& ) = delete;
+    SpscQueue& operator=( SpscQueue&& ) = delete;
+
+    static constexpr std::size_t capacity() noexcept { return N; }
+
+    // Producer side only: returns false if the queue is full
+    bool tryPush( const T& item ) noexcept
+    {
+        std::uint32_t write{ mWriteIndex.loadRelaxed() };
+        if ( write - mReadIndex.loadAcquire() >= N )
+        {
+            return false;
+        }
+
+        mBuffer[ write & kMask ] = item;
+        mWriteIndex.storeRelease( write + 1 );
+        return true;
+    }
+
+    // Consumer side only: returns false if the queue is empty
+    bool tryPop( T* item ) noexcept
+    {
+        std::uint32_t read{ mReadIndex.loadRelaxed() };
+        if ( mWriteIndex.loadAcquire() == read )
+        {
+            return false;
+        }
+
+        *item = mBuffer[ read & kMask ];
+        mReadIndex.storeRelease( read + 1 );
+        return true;
+    }
+
+    // Consumer side only: look at the next item without removing it
+    bool peek( T* item ) const noexcept
+    {
+        std::uint32_t read{ mReadIndex.loadRelaxed() };
+        if ( mWriteIndex.loadAcquire() == read )
+        {
+            return false;
+        }
+
+        *item = mBuffer[ read & kMask ];
+        return true;
+    }
+
+    // Consumer side only: discard everything currently queued
+    void clear() noexcept
+    {
+        mReadIndex.storeRelease( mWriteIndex.loadAcquire() );
+    }
+
+    // These can be called from either side, but the answer is only a
+    // snapshot: the other side may change it immediately afterwards
+    std::size_t size() const noexcept
+    {
+        // Read index first: it never passes the write index, so the
+        // difference can't go negative even if both sides are active
+        std::uint32_t read{ mReadIndex.loadAcquire() };
+        return mWriteIndex.loadAcquire() - read;
+    }
+
+    bool isEmpty() const noexcept { return size() == 0; }
+
+    bool isFull() const noexcept { return size() >= N; }
+
+private:
+    static constexpr std::uint32_t kMask{ N - 1 };
+
+    T mBuffer[ N ];
+    SpscInternal::Index mWriteIndex;
+    SpscInternal::Index mReadIndex;
+};
+
+#endif    // SpscQueue_hpp
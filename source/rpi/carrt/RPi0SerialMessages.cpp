@@ -589,6 +589,40 @@ void ResetPicoMsg::takeAction( EventManager&, SerialLink& link )
 
 
 
+ResetPicoConfigMsg::ResetPicoConfigMsg() noexcept
+: NoContentMsg( MsgId::kResetPicoConfig )
+{
+    mNeedsAction = true;
+}
+
+ResetPicoConfigMsg::ResetPicoConfigMsg( MsgId id ) noexcept
+: NoContentMsg( id )
+{
+    debugCond2cout<kDebugSerialMsgs>( "RPi0 got ResetPicoConfigMsg", getIdNum() );
+    mNeedsAction = true;
+}
+
+
+void ResetPicoConfigMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        // If Pico sending, do it by calling sendOut()
+        mNeedsAction = false;
+
+        // Pico has erased its saved config and is back to its defaults
+        output2cout( "Pico reset its saved config", getIdNum() );
+    }
+}
+
+
+
+
+/*********************************************************************************************/
+
+
+
+
 TimerEventMsg::TimerEventMsg() noexcept 
 : SerialMessage( MsgId::kTimerEventMsg ), mContent( MsgId::kTimerEventMsg ), mNeedsAction{ false } 
 {}
@@ -936,6 +970,65 @@ void ResetBNO055Msg::takeAction( EventManager&, SerialLink& link )
 
 
 
+CalibrationProfileMsg::CalibrationProfileMsg() noexcept
+: SerialMessage( MsgId::kCalibrationProfile ), mContent( MsgId::kCalibrationProfile ), mNeedsAction{ false }
+{}
+
+CalibrationProfileMsg::CalibrationProfileMsg( TheData t ) noexcept
+: SerialMessage( MsgId::kCalibrationProfile ), mContent( MsgId::kCalibrationProfile, t ), mNeedsAction{ true }
+{}
+
+CalibrationProfileMsg::CalibrationProfileMsg( const Profile& profile ) noexcept 
+: SerialMessage( MsgId::kCalibrationProfile ), mContent( MsgId::kCalibrationProfile, std::tuple_cat( profile ) ), mNeedsAction{ true }
+{}
+
+CalibrationProfileMsg::CalibrationProfileMsg( MsgId id )
+: SerialMessage( id ), mContent( MsgId::kCalibrationProfile ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kCalibrationProfile ) 
+    { 
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1, std::to_underlying( MsgId::kCalibrationProfile ) ), "Id mismatch at creation" ); 
+    } 
+    // Note that it doesn't need action until loaded with data
+}
+
+
+void CalibrationProfileMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "RPi0 got CalibrationProfileMsg", getIdNum() );
+}
+
+
+void CalibrationProfileMsg::sendOut( SerialLink& link )
+{
+    mContent.sendOut( link );
+
+    debugCond2cout<kDebugSerialMsgs>( "CalibrationProfileMsg sent to Pico", getIdNum() );
+}
+
+
+void CalibrationProfileMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        // TODO save the profile so it can be sent back to the Pico at the next start up
+        mNeedsAction = false;
+
+        output2cout( "TODO RPi0 save CalibrationProfileMsg", getIdNum() );
+    }
+}
+
+
+
+
+/*********************************************************************************************/
+
+
+
+
 NavUpdateMsg::NavUpdateMsg() noexcept
 : SerialMessage( MsgId::kTimerNavUpdate ), mContent( MsgId::kTimerNavUpdate ), mNeedsAction{ false }
 {}
@@ -945,8 +1038,8 @@ NavUpdateMsg::NavUpdateMsg( TheData t ) noexcept
 {}
 
 
-NavUpdateMsg::NavUpdateMsg(  float heading, std::uint32_t time  ) noexcept
-: SerialMessage( MsgId::kTimerNavUpdate ), mContent( MsgId::kTimerNavUpdate, std::make_tuple( heading, time ) ), mNeedsAction{ true }
+NavUpdateMsg::NavUpdateMsg(  std::int16_t rawHeading, std::uint32_t time  ) noexcept
+: SerialMessage( MsgId::kTimerNavUpdate ), mContent( MsgId::kTimerNavUpdate, std::make_tuple( rawHeading, time ) ), mNeedsAction{ true }
 {}
 
 
@@ -986,7 +1079,135 @@ void NavUpdateMsg::takeAction( EventManager&, SerialLink& link )
         // TODO  do something with the nav update
         mNeedsAction = false;
 
-        output2cout( "TODO RPi0 do something NavUpdateMsg info", getIdNum(), std::get<0>( mContent.mMsg ), std::get<1>( mContent.mMsg ) );
+        output2cout( "TODO RPi0 do something NavUpdateMsg info", getIdNum(), getHeading(), std::get<1>( mContent.mMsg ) );
+    }
+}
+
+
+
+
+/*********************************************************************************************/
+
+
+
+
+ExtendedNavUpdateMsg::ExtendedNavUpdateMsg() noexcept
+: SerialMessage( MsgId::kExtendedNavUpdate ), mContent( MsgId::kExtendedNavUpdate ), mNeedsAction{ false }
+{}
+
+ExtendedNavUpdateMsg::ExtendedNavUpdateMsg( TheData t ) noexcept
+: SerialMessage( MsgId::kExtendedNavUpdate ), mContent( MsgId::kExtendedNavUpdate, t ), mNeedsAction{ true }
+{}
+
+
+ExtendedNavUpdateMsg::ExtendedNavUpdateMsg( const Triplet& euler, const Triplet& gyro, const Triplet& linAccel, std::uint8_t calibration, std::uint32_t time ) noexcept
+: SerialMessage( MsgId::kExtendedNavUpdate ), 
+    mContent( MsgId::kExtendedNavUpdate, std::tuple_cat( euler, gyro, linAccel, std::make_tuple( calibration, time ) ) ), 
+    mNeedsAction{ true }
+{}
+
+
+ExtendedNavUpdateMsg::ExtendedNavUpdateMsg( MsgId id )
+: SerialMessage( MsgId::kExtendedNavUpdate ), mContent( MsgId::kExtendedNavUpdate ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kExtendedNavUpdate ) 
+    { 
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1, std::to_underlying( MsgId::kExtendedNavUpdate ) ), "Id mismatch at creation" ); 
+    } 
+    // Note that it doesn't need action until loaded with data
+}
+
+
+void ExtendedNavUpdateMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "Got ExtendedNavUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ), std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ), std::get<10>( mContent.mMsg ) );
+}
+
+
+void ExtendedNavUpdateMsg::sendOut( SerialLink& link )
+{
+    // RPi0 never sends this
+
+    output2cout( "Error: RPi0 sending ExtendedNavUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ), std::get<10>( mContent.mMsg ) );
+}
+
+
+
+void ExtendedNavUpdateMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        // TODO  do something with the extended nav update
+        mNeedsAction = false;
+
+        output2cout( "TODO RPi0 do something ExtendedNavUpdateMsg info", getIdNum(), TelemetryUnits::rawAngleToDegrees( std::get<0>( mContent.mMsg ) ), 
+            TelemetryUnits::rawAngleToDegrees( std::get<1>( mContent.mMsg ) ), TelemetryUnits::rawAngleToDegrees( std::get<2>( mContent.mMsg ) ), 
+            TelemetryUnits::rawGyroToDps( std::get<5>( mContent.mMsg ) ), std::get<10>( mContent.mMsg ) );
+    }
+}
+
+
+
+
+/*********************************************************************************************/
+
+
+
+
+PoseUpdateMsg::PoseUpdateMsg() noexcept
+: SerialMessage( MsgId::kPoseUpdate ), mContent( MsgId::kPoseUpdate ), mNeedsAction{ false }
+{}
+
+PoseUpdateMsg::PoseUpdateMsg( TheData t ) noexcept
+: SerialMessage( MsgId::kPoseUpdate ), mContent( MsgId::kPoseUpdate, t ), mNeedsAction{ true }
+{}
+
+
+PoseUpdateMsg::PoseUpdateMsg( std::int32_t x, std::int32_t y, std::int16_t rawHeading, std::uint32_t time ) noexcept
+: SerialMessage( MsgId::kPoseUpdate ), mContent( MsgId::kPoseUpdate, std::make_tuple( x, y, rawHeading, time ) ), mNeedsAction{ true }
+{}
+
+
+PoseUpdateMsg::PoseUpdateMsg( MsgId id )
+: SerialMessage( MsgId::kPoseUpdate ), mContent( MsgId::kPoseUpdate ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kPoseUpdate ) 
+    { 
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1, std::to_underlying( MsgId::kPoseUpdate ) ), "Id mismatch at creation" ); 
+    } 
+    // Note that it doesn't need action until loaded with data
+}
+
+
+void PoseUpdateMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "Got PoseUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ), std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ), std::get<3>( mContent.mMsg ) );
+}
+
+
+void PoseUpdateMsg::sendOut( SerialLink& link )
+{
+    // RPi0 never sends this
+
+    output2cout( "Error: RPi0 sending PoseUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ), std::get<1>( mContent.mMsg ), std::get<3>( mContent.mMsg ) );
+}
+
+
+
+void PoseUpdateMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        // TODO  do something with the pose update
+        mNeedsAction = false;
+
+        output2cout( "TODO RPi0 do something PoseUpdateMsg info", getIdNum(), getX(), getY(), getHeading(), std::get<3>( mContent.mMsg ) );
     }
 }
 
@@ -1006,9 +1227,9 @@ NavUpdateControlMsg::NavUpdateControlMsg( TheData t ) noexcept
 : SerialMessage( MsgId::kNavUpdateControl ), mContent( MsgId::kNavUpdateControl, t ), mNeedsAction{ true } 
 {} 
 
-NavUpdateControlMsg::NavUpdateControlMsg( bool wantNavUpdates, bool wantNavStatus ) noexcept 
+NavUpdateControlMsg::NavUpdateControlMsg( bool wantNavUpdates, bool wantNavStatus, bool wantExtendedNav, bool wantPose ) noexcept 
 : SerialMessage( MsgId::kNavUpdateControl ), 
-    mContent( MsgId::kNavUpdateControl, std::make_tuple( static_cast<std::uint8_t>( wantNavUpdates ), static_cast<std::uint8_t>( wantNavStatus ) ) ), 
+    mContent( MsgId::kNavUpdateControl, std::make_tuple( static_cast<std::uint8_t>( wantNavUpdates ), static_cast<std::uint8_t>( wantNavStatus ), static_cast<std::uint8_t>( wantExtendedNav ), static_cast<std::uint8_t>( wantPose ) ) ), 
     mNeedsAction{ true } 
 {}
 
@@ -1029,7 +1250,7 @@ void NavUpdateControlMsg::readIn( SerialLink& link )
     mNeedsAction = false;
 
     output2cout( "Error: RPi0 got NavUpdateControlMsg", getIdNum(), 
-        static_cast<bool>( std::get<0>( mContent.mMsg) ), static_cast<bool>( std::get<1>( mContent.mMsg) ) );
+        static_cast<bool>( std::get<0>( mContent.mMsg) ), static_cast<bool>( std::get<1>( mContent.mMsg) ), static_cast<bool>( std::get<2>( mContent.mMsg) ), static_cast<bool>( std::get<3>( mContent.mMsg) ) );
 }
 
 void NavUpdateControlMsg::sendOut( SerialLink& link )
@@ -1037,7 +1258,7 @@ void NavUpdateControlMsg::sendOut( SerialLink& link )
     mContent.sendOut( link );
 
     debugCond2cout<kDebugSerialMsgs>( "NavUpdateControlMsg sent to Pico", 
-        static_cast<bool>( std::get<0>( mContent.mMsg) ), static_cast<bool>( std::get<1>( mContent.mMsg) ) );    
+        static_cast<bool>( std::get<0>( mContent.mMsg) ), static_cast<bool>( std::get<1>( mContent.mMsg) ), static_cast<bool>( std::get<2>( mContent.mMsg) ), static_cast<bool>( std::get<3>( mContent.mMsg) ) );    
 }
 
 void NavUpdateControlMsg::takeAction( EventManager&, SerialLink& link ) 
@@ -1058,6 +1279,62 @@ void NavUpdateControlMsg::takeAction( EventManager&, SerialLink& link )
 
 
 
+NavRateControlMsg::NavRateControlMsg() noexcept 
+: SerialMessage( MsgId::kNavRateControl ), mContent( MsgId::kNavRateControl ), mNeedsAction{ false } 
+{}
+
+NavRateControlMsg::NavRateControlMsg( TheData t ) noexcept 
+: SerialMessage( MsgId::kNavRateControl ), mContent( MsgId::kNavRateControl, t ), mNeedsAction{ true } 
+{} 
+
+NavRateControlMsg::NavRateControlMsg( std::uint8_t hz ) noexcept 
+: SerialMessage( MsgId::kNavRateControl ), mContent( MsgId::kNavRateControl, std::make_tuple( hz ) ), mNeedsAction{ true } 
+{}
+
+NavRateControlMsg::NavRateControlMsg( MsgId id ) 
+: SerialMessage( id ), mContent( MsgId::kNavRateControl ), mNeedsAction{ false }
+{ 
+    if ( id != MsgId::kNavRateControl ) 
+    { 
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1, std::to_underlying( MsgId::kNavRateControl ) ), "Id mismatch at creation" ); 
+    } 
+    // Note that it doesn't need action until loaded with data
+}
+
+
+void NavRateControlMsg::readIn( SerialLink& link ) 
+{
+    mContent.readIn( link );
+    mNeedsAction = false;
+
+    output2cout( "Error: RPi0 got NavRateControlMsg", static_cast<int>( std::get<0>( mContent.mMsg ) ) );
+}
+
+void NavRateControlMsg::sendOut( SerialLink& link )
+{
+    mContent.sendOut( link );
+
+    output2cout( "RPi0 sent NavRateControlMsg", static_cast<int>( std::get<0>( mContent.mMsg ) ) );
+}
+
+void NavRateControlMsg::takeAction( EventManager&, SerialLink& link ) 
+{
+    if ( mNeedsAction )
+    {
+        // This message should only be sent, not received
+        output2cout( "Error: Trying to takeAction() on local Msg", getIdNum() );
+        mNeedsAction = false;
+    }
+}
+
+
+
+
+/*********************************************************************************************/
+
+
+
+
 DrivingStatusUpdateMsg::DrivingStatusUpdateMsg() noexcept 
 : SerialMessage( MsgId::kDrivingStatusUpdate ), mContent( MsgId::kDrivingStatusUpdate ), mNeedsAction{ false } 
 {}
@@ -1109,6 +1386,63 @@ void DrivingStatusUpdateMsg::takeAction( EventManager&, SerialLink& link )
 
 
 
+
+/*********************************************************************************************/
+
+
+
+
+ImpactControlMsg::ImpactControlMsg() noexcept 
+: SerialMessage( MsgId::kImpactControl ), mContent( MsgId::kImpactControl ), mNeedsAction{ false } 
+{}
+
+ImpactControlMsg::ImpactControlMsg( TheData t ) noexcept 
+: SerialMessage( MsgId::kImpactControl ), mContent( MsgId::kImpactControl, t ), mNeedsAction{ true } 
+{} 
+
+ImpactControlMsg::ImpactControlMsg( bool enable, std::uint16_t accelThreshold, std::uint16_t stallMs ) noexcept 
+: SerialMessage( MsgId::kImpactControl ), mContent( MsgId::kImpactControl, std::make_tuple( static_cast<std::uint8_t>( enable ), accelThreshold, stallMs ) ), mNeedsAction{ true } 
+{}
+
+ImpactControlMsg::ImpactControlMsg( MsgId id ) 
+: SerialMessage( id ), mContent( MsgId::kImpactControl ), mNeedsAction{ false }
+{ 
+    if ( id != MsgId::kImpactControl ) 
+    { 
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1, std::to_underlying( MsgId::kImpactControl ) ), "Id mismatch at creation" ); 
+    } 
+    // Note that it doesn't need action until loaded with data
+}
+
+
+void ImpactControlMsg::readIn( SerialLink& link ) 
+{
+    mContent.readIn( link );
+    mNeedsAction = false;
+
+    output2cout( "Error: RPi0 got ImpactControlMsg", getIdNum(), static_cast<bool>( std::get<0>( mContent.mMsg ) ), std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ) );
+}
+
+void ImpactControlMsg::sendOut( SerialLink& link )
+{
+    mContent.sendOut( link );
+    
+    debugCond2cout<kDebugSerialMsgs>( "RPi0 sent ImpactControlMsg", getIdNum(), static_cast<bool>( std::get<0>( mContent.mMsg ) ), std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ) ); 
+}
+
+void ImpactControlMsg::takeAction( EventManager&, SerialLink& link ) 
+{
+    if ( mNeedsAction )
+    {
+        // This message should only be sent, not received
+        output2cout( "Error: Trying to takeAction() on local Msg", getIdNum() );
+        mNeedsAction = false;
+    }
+}
+
+
+
+
 /*********************************************************************************************/
 
 
@@ -1122,8 +1456,8 @@ EncoderUpdateMsg::EncoderUpdateMsg( TheData t ) noexcept
 : SerialMessage( MsgId::kEncoderUpdate ), mContent( MsgId::kEncoderUpdate, t ), mNeedsAction{ true }
 {} 
 
-EncoderUpdateMsg::EncoderUpdateMsg( Side side, int count, std::uint32_t time ) noexcept 
-: SerialMessage( MsgId::kEncoderUpdate ), mContent( MsgId::kEncoderUpdate, std::make_tuple( std::to_underlying( side ), count, time ) ), mNeedsAction{ true } 
+EncoderUpdateMsg::EncoderUpdateMsg( std::uint16_t leftSpeed, std::uint16_t rightSpeed, std::uint32_t leftDistance, std::uint32_t rightDistance, std::uint32_t time ) noexcept 
+: SerialMessage( MsgId::kEncoderUpdate ), mContent( MsgId::kEncoderUpdate, std::make_tuple( leftSpeed, rightSpeed, leftDistance, rightDistance, time ) ), mNeedsAction{ true } 
 {}
 
 EncoderUpdateMsg::EncoderUpdateMsg( MsgId id ) 
@@ -1142,14 +1476,14 @@ void EncoderUpdateMsg::readIn( SerialLink& link )
     mContent.readIn( link );
     mNeedsAction = true;
 
-    debugCond2cout<kDebugSerialMsgs>( "RPi0 got EncoderUpdateMsg", std::get<0>( mContent.mMsg ), std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ) );
+    debugCond2cout<kDebugSerialMsgs>( "RPi0 got EncoderUpdateMsg", std::get<0>( mContent.mMsg ), std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ), std::get<3>( mContent.mMsg ), std::get<4>( mContent.mMsg ) );
 }
 
 void EncoderUpdateMsg::sendOut( SerialLink& link )
 {
     // RPi0 never sends this
 
-    output2cout( "Error: RPi0 sends EncoderUpdateMsg", std::get<0>( mContent.mMsg ), std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ) );
+    output2cout( "Error: RPi0 sends EncoderUpdateMsg", std::get<0>( mContent.mMsg ), std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ), std::get<3>( mContent.mMsg ), std::get<4>( mContent.mMsg ) );
 }
 
 void EncoderUpdateMsg::takeAction( EventManager&, SerialLink& link ) 
@@ -1160,7 +1494,7 @@ void EncoderUpdateMsg::takeAction( EventManager&, SerialLink& link )
         // TODO
         mNeedsAction = false;
 
-        output2cout( "TODO process EncoderUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ), std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ) );
+        output2cout( "TODO process EncoderUpdateMsg", getIdNum(), getLeftSpeed(), getRightSpeed(), std::get<2>( mContent.mMsg ), std::get<3>( mContent.mMsg ), std::get<4>( mContent.mMsg ) );
     }
 }
 
@@ -1292,8 +1626,8 @@ BatteryLevelUpdateMsg::BatteryLevelUpdateMsg( TheData t ) noexcept
 : SerialMessage( MsgId::kBatteryLevelUpdate ), mContent( MsgId::kBatteryLevelUpdate, t ), mNeedsAction{ true } 
 {} 
 
-BatteryLevelUpdateMsg::BatteryLevelUpdateMsg( Battery whichBattery, float level ) noexcept 
-: SerialMessage( MsgId::kBatteryLevelUpdate ), mContent( MsgId::kBatteryLevelUpdate, std::make_tuple( std::to_underlying( whichBattery ), level ) ), 
+BatteryLevelUpdateMsg::BatteryLevelUpdateMsg( Battery whichBattery, std::uint16_t rawCounts ) noexcept 
+: SerialMessage( MsgId::kBatteryLevelUpdate ), mContent( MsgId::kBatteryLevelUpdate, std::make_tuple( std::to_underlying( whichBattery ), rawCounts ) ), 
     mNeedsAction{ true } 
 {}
 
@@ -1330,7 +1664,188 @@ void BatteryLevelUpdateMsg::takeAction( EventManager&, SerialLink& link )
         // TODO act on this
         mNeedsAction = false;
 
-        output2cout( "TODO: RPi0 act on BatteryLevelUpdateMsg", getIdNum(), static_cast<int>( std::get<0>( mContent.mMsg ) ), std::get<1>( mContent.mMsg ) );
+        output2cout( "TODO: RPi0 act on BatteryLevelUpdateMsg", getIdNum(), static_cast<int>( std::get<0>( mContent.mMsg ) ), getVolts() );
+    }
+}
+
+
+
+
+
+/*********************************************************************************************/
+
+
+
+
+EventStatsRequestMsg::EventStatsRequestMsg() noexcept 
+: SerialMessage( MsgId::kEventStatsRequest ), mContent( MsgId::kEventStatsRequest ), mNeedsAction{ false } 
+{}
+
+EventStatsRequestMsg::EventStatsRequestMsg( TheData t ) noexcept 
+: SerialMessage( MsgId::kEventStatsRequest ), mContent( MsgId::kEventStatsRequest, t ), mNeedsAction{ true } 
+{} 
+
+EventStatsRequestMsg::EventStatsRequestMsg( bool resetAfter ) noexcept 
+: SerialMessage( MsgId::kEventStatsRequest ), mContent( MsgId::kEventStatsRequest, std::make_tuple( static_cast<std::uint8_t>( resetAfter ) ) ), 
+    mNeedsAction{ true } 
+{}
+
+EventStatsRequestMsg::EventStatsRequestMsg( MsgId id ) 
+: SerialMessage( id ), mContent( MsgId::kEventStatsRequest ), mNeedsAction{ false }
+{ 
+    if ( id != MsgId::kEventStatsRequest ) 
+    { 
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1, std::to_underlying( MsgId::kEventStatsRequest ) ), "Id mismatch at creation" ); 
+    } 
+    // Note that it doesn't need action until loaded with data
+}
+
+
+void EventStatsRequestMsg::readIn( SerialLink& link ) 
+{
+    mContent.readIn( link );
+    mNeedsAction = false;
+
+    output2cout( "Error: RPi0 got EventStatsRequestMsg", static_cast<int>( std::get<0>( mContent.mMsg ) ) );
+}
+
+void EventStatsRequestMsg::sendOut( SerialLink& link )
+{
+    mContent.sendOut( link );
+
+    output2cout( "RPi0 sent EventStatsRequestMsg", static_cast<int>( std::get<0>( mContent.mMsg ) ) );
+}
+
+void EventStatsRequestMsg::takeAction( EventManager&, SerialLink& link ) 
+{
+    if ( mNeedsAction )
+    {
+        // This message should only be sent, not received
+        output2cout( "Error: Trying to takeAction() on local Msg", getIdNum() );
+        mNeedsAction = false;
+    }
+}
+
+
+
+
+/*********************************************************************************************/
+
+
+
+
+EventStatsMsg::EventStatsMsg() noexcept 
+: SerialMessage( MsgId::kEventStats ), mContent( MsgId::kEventStats ), mNeedsAction{ false } 
+{}
+
+EventStatsMsg::EventStatsMsg( TheData t ) noexcept 
+: SerialMessage( MsgId::kEventStats ), mContent( MsgId::kEventStats, t ), mNeedsAction{ true } 
+{} 
+
+EventStatsMsg::EventStatsMsg( std::uint8_t evtId, EventStatsKind kind, std::uint32_t maxUs, const EventStatsCounts& counts ) noexcept 
+: SerialMessage( MsgId::kEventStats ), 
+    mContent( MsgId::kEventStats, std::tuple_cat( std::make_tuple( evtId, std::to_underlying( kind ), maxUs ), counts ) ), 
+    mNeedsAction{ true } 
+{}
+
+EventStatsMsg::EventStatsMsg( MsgId id ) 
+: SerialMessage( id ), mContent( MsgId::kEventStats ), mNeedsAction{ false }
+{ 
+    if ( id != MsgId::kEventStats ) 
+    { 
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1, std::to_underlying( MsgId::kEventStats ) ), "Id mismatch at creation" ); 
+    } 
+    // Note that it doesn't need action until loaded with data
+}
+
+
+void EventStatsMsg::readIn( SerialLink& link ) 
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "RPi0 got EventStatsMsg", getIdNum(), static_cast<int>( std::get<0>( mContent.mMsg ) ), 
+                    static_cast<int>( std::get<1>( mContent.mMsg ) ), std::get<2>( mContent.mMsg ) );
+}
+
+void EventStatsMsg::sendOut( SerialLink& link )
+{
+    // RPi0 never sends this
+
+    output2cout( "Error: RPi0 sending EventStatsMsg", getIdNum(), static_cast<int>( std::get<0>( mContent.mMsg ) ) );
+}
+
+void EventStatsMsg::takeAction( EventManager&, SerialLink& link ) 
+{
+    if ( mNeedsAction )
+    {
+        // TODO act on this
+        mNeedsAction = false;
+
+        output2cout( "TODO: RPi0 act on EventStatsMsg", getIdNum(), static_cast<int>( std::get<0>( mContent.mMsg ) ), 
+                    static_cast<int>( std::get<1>( mContent.mMsg ) ), std::get<2>( mContent.mMsg ) );
+    }
+}
+
+
+
+
+
+/*********************************************************************************************/
+
+
+
+
+MemoryStatsMsg::MemoryStatsMsg() noexcept 
+: SerialMessage( MsgId::kMemoryStats ), mContent( MsgId::kMemoryStats ), mNeedsAction{ false } 
+{}
+
+MemoryStatsMsg::MemoryStatsMsg( TheData t ) noexcept 
+: SerialMessage( MsgId::kMemoryStats ), mContent( MsgId::kMemoryStats, t ), mNeedsAction{ true } 
+{} 
+
+MemoryStatsMsg::MemoryStatsMsg( std::uint32_t heapUsed, std::uint32_t heapHighWater, std::uint32_t heapFree, std::uint16_t core0StackFree, std::uint16_t core1StackFree, std::uint32_t time ) noexcept 
+: SerialMessage( MsgId::kMemoryStats ), 
+    mContent( MsgId::kMemoryStats, std::make_tuple( heapUsed, heapHighWater, heapFree, core0StackFree, core1StackFree, time ) ), 
+    mNeedsAction{ true } 
+{}
+
+MemoryStatsMsg::MemoryStatsMsg( MsgId id ) 
+: SerialMessage( id ), mContent( MsgId::kMemoryStats ), mNeedsAction{ false }
+{ 
+    if ( id != MsgId::kMemoryStats ) 
+    { 
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1, std::to_underlying( MsgId::kMemoryStats ) ), "Id mismatch at creation" ); 
+    } 
+    // Note that it doesn't need action until loaded with data
+}
+
+
+void MemoryStatsMsg::readIn( SerialLink& link ) 
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "RPi0 got MemoryStatsMsg", getIdNum(), std::get<0>( mContent.mMsg ), std::get<1>( mContent.mMsg ), 
+                    std::get<2>( mContent.mMsg ), std::get<3>( mContent.mMsg ), std::get<4>( mContent.mMsg ) );
+}
+
+void MemoryStatsMsg::sendOut( SerialLink& link )
+{
+    // RPi0 never sends this
+
+    output2cout( "Error: RPi0 sending MemoryStatsMsg", getIdNum() );
+}
+
+void MemoryStatsMsg::takeAction( EventManager&, SerialLink& link ) 
+{
+    if ( mNeedsAction )
+    {
+        // TODO act on this
+        mNeedsAction = false;
+
+        output2cout( "TODO: RPi0 act on MemoryStatsMsg", getIdNum(), std::get<0>( mContent.mMsg ), std::get<1>( mContent.mMsg ), 
+                    std::get<2>( mContent.mMsg ), std::get<3>( mContent.mMsg ), std::get<4>( mContent.mMsg ) );
     }
 }
 
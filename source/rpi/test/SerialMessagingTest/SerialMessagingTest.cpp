@@ -26,7 +26,7 @@ int main()
 
     std::cout << "Serial link test" << std::endl;
 
-    SerialMessageProcessor smp( 32, pico );
+    SerialMessageProcessor smp( pico );
     setupMessageProcessor( smp );
 
     EventManager events;
@@ -116,6 +116,7 @@ void setupMessageProcessor( SerialMessageProcessor& smp )
     smp.registerMessage<PicoSaysStopMsg>( MsgId::kPicoSaysStop );
     // smp.registerMessage<MsgControlMsg>( MsgId::kMsgControlMsg );
     smp.registerMessage<ResetPicoMsg>( MsgId::kResetPicoMsg );
+    smp.registerMessage<ResetPicoConfigMsg>( MsgId::kResetPicoConfig );
     smp.registerMessage<TimerEventMsg>( MsgId::kTimerEventMsg );
     // smp.registerMessage<TimerControlMsg>( MsgId::kTimerControl );
     // smp.registerMessage<BeginCalibrationMsg>( MsgId::kBeginCalibration );
@@ -123,13 +124,21 @@ void setupMessageProcessor( SerialMessageProcessor& smp )
     smp.registerMessage<CalibrationInfoUpdateMsg>( MsgId::kCalibrationInfoUpdate );
     // smp.registerMessage<SetAutoCalibrateMsg>( MsgId::kSetAutoCalibrate );
     // smp.registerMessage<ResetBNO055Msg>( MsgId::kResetBNO055 );
+    smp.registerMessage<CalibrationProfileMsg>( MsgId::kCalibrationProfile );
     smp.registerMessage<NavUpdateMsg>( MsgId::kTimerNavUpdate );
+    smp.registerMessage<ExtendedNavUpdateMsg>( MsgId::kExtendedNavUpdate );
+    smp.registerMessage<PoseUpdateMsg>( MsgId::kPoseUpdate );
     // smp.registerMessage<NavUpdateControlMsg>( MsgId::kNavUpdateControl );
+    // smp.registerMessage<NavRateControlMsg>( MsgId::kNavRateControl );
     // smp.registerMessage<DrivingStatusUpdateMsg>( MsgId::kDrivingStatusUpdate );
+    // smp.registerMessage<ImpactControlMsg>( MsgId::kImpactControl );
     smp.registerMessage<EncoderUpdateMsg>( MsgId::kEncoderUpdate );
     // smp.registerMessage<EncoderUpdateControlMsg>( MsgId::kEncoderUpdateControl );
     // smp.registerMessage<BatteryLevelRequestMsg>( MsgId::kBatteryLevelRequest );
     smp.registerMessage<BatteryLevelUpdateMsg>( MsgId::kBatteryLevelUpdate );
+    // smp.registerMessage<EventStatsRequestMsg>( MsgId::kEventStatsRequest );
+    smp.registerMessage<EventStatsMsg>( MsgId::kEventStats );
+    smp.registerMessage<MemoryStatsMsg>( MsgId::kMemoryStats );
     smp.registerMessage<ErrorReportMsg>( MsgId::kErrorReportFromPico );
     // smp.registerMessage<TestPicoErrorRptMsg>( MsgId::kTestPicoReportError );
     // smp.registerMessage<TestPicoMessagesMsg>( MsgId::kTestPicoMessages );
@@ -540,6 +540,32 @@ void ResetPicoMsg::takeAction( EventManager&, SerialLink& link )
 
 /*********************************************************************************************/
 
+ResetPicoConfigMsg::ResetPicoConfigMsg() noexcept
+    : NoContentMsg( MsgId::kResetPicoConfig )
+{
+    mNeedsAction = true;
+}
+
+ResetPicoConfigMsg::ResetPicoConfigMsg( MsgId id ) noexcept
+    : NoContentMsg( id )
+{
+    debugCond2cout<kDebugSerialMsgs>( "RPi0 got ResetPicoConfigMsg", getIdNum() );
+    mNeedsAction = true;
+}
+
+void ResetPicoConfigMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        // If Pico sending, do it by calling sendOut()
+        mNeedsAction = false;
+
+        output2cout( "Got ResetPicoConfigMsg", getIdNum() );
+    }
+}
+
+/*********************************************************************************************/
+
 TimerEventMsg::TimerEventMsg() noexcept
     : SerialMessage( MsgId::kTimerEventMsg ),
       mContent( MsgId::kTimerEventMsg ),
@@ -876,6 +902,65 @@ void ResetBNO055Msg::takeAction( EventManager&, SerialLink& link )
 
 /*********************************************************************************************/
 
+CalibrationProfileMsg::CalibrationProfileMsg() noexcept
+    : SerialMessage( MsgId::kCalibrationProfile ),
+      mContent( MsgId::kCalibrationProfile ),
+      mNeedsAction{ false }
+{}
+
+CalibrationProfileMsg::CalibrationProfileMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kCalibrationProfile ),
+      mContent( MsgId::kCalibrationProfile, t ),
+      mNeedsAction{ true }
+{}
+
+CalibrationProfileMsg::CalibrationProfileMsg( const Profile& profile ) noexcept
+    : SerialMessage( MsgId::kCalibrationProfile ),
+      mContent( MsgId::kCalibrationProfile, std::tuple_cat( profile ) ),
+      mNeedsAction{ true }
+{}
+
+CalibrationProfileMsg::CalibrationProfileMsg( MsgId id )
+    : SerialMessage( id ), mContent( MsgId::kCalibrationProfile ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kCalibrationProfile )
+    {
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1,
+                                           std::to_underlying( MsgId::kCalibrationProfile ) ),
+                          "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void CalibrationProfileMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "RPi0 got CalibrationProfileMsg", getIdNum() );
+}
+
+void CalibrationProfileMsg::sendOut( SerialLink& link )
+{
+    mContent.sendOut( link );
+
+    debugCond2cout<kDebugSerialMsgs>( "CalibrationProfileMsg sent to Pico", getIdNum() );
+}
+
+void CalibrationProfileMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        mNeedsAction = false;
+
+        auto [ ax, ay, az, mx, my, mz, gx, gy, gz, aRadius, mRadius ] = mContent.mMsg;
+        output2cout( "Got CalibrationProfileMsg", getIdNum(), "accel", ax, ay, az, "mag", mx, my,
+                     mz, "gyro", gx, gy, gz, "radii", aRadius, mRadius );
+    }
+}
+
+/*********************************************************************************************/
+
 NavUpdateMsg::NavUpdateMsg() noexcept
     : SerialMessage( MsgId::kTimerNavUpdate ),
       mContent( MsgId::kTimerNavUpdate ),
@@ -888,9 +973,9 @@ NavUpdateMsg::NavUpdateMsg( TheData t ) noexcept
       mNeedsAction{ true }
 {}
 
-NavUpdateMsg::NavUpdateMsg( float heading, std::uint32_t time ) noexcept
+NavUpdateMsg::NavUpdateMsg( std::int16_t rawHeading, std::uint32_t time ) noexcept
     : SerialMessage( MsgId::kTimerNavUpdate ),
-      mContent( MsgId::kTimerNavUpdate, std::make_tuple( heading, time ) ),
+      mContent( MsgId::kTimerNavUpdate, std::make_tuple( rawHeading, time ) ),
       mNeedsAction{ true }
 {}
 
@@ -932,8 +1017,145 @@ void NavUpdateMsg::takeAction( EventManager&, SerialLink& link )
         // TODO  do something with the nav update
         mNeedsAction = false;
 
-        output2cout( "Got NavUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ),
-                     std::get<1>( mContent.mMsg ) );
+        output2cout( "Got NavUpdateMsg", getIdNum(), getHeading(), std::get<1>( mContent.mMsg ) );
+    }
+}
+
+/*********************************************************************************************/
+
+ExtendedNavUpdateMsg::ExtendedNavUpdateMsg() noexcept
+    : SerialMessage( MsgId::kExtendedNavUpdate ),
+      mContent( MsgId::kExtendedNavUpdate ),
+      mNeedsAction{ false }
+{}
+
+ExtendedNavUpdateMsg::ExtendedNavUpdateMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kExtendedNavUpdate ),
+      mContent( MsgId::kExtendedNavUpdate, t ),
+      mNeedsAction{ true }
+{}
+
+ExtendedNavUpdateMsg::ExtendedNavUpdateMsg( const Triplet& euler, const Triplet& gyro,
+                                            const Triplet& linAccel, std::uint8_t calibration,
+                                            std::uint32_t time ) noexcept
+    : SerialMessage( MsgId::kExtendedNavUpdate ),
+      mContent( MsgId::kExtendedNavUpdate,
+                std::tuple_cat( euler, gyro, linAccel, std::make_tuple( calibration, time ) ) ),
+      mNeedsAction{ true }
+{}
+
+ExtendedNavUpdateMsg::ExtendedNavUpdateMsg( MsgId id )
+    : SerialMessage( MsgId::kExtendedNavUpdate ),
+      mContent( MsgId::kExtendedNavUpdate ),
+      mNeedsAction{ false }
+{
+    if ( id != MsgId::kExtendedNavUpdate )
+    {
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1,
+                                           std::to_underlying( MsgId::kExtendedNavUpdate ) ),
+                          "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void ExtendedNavUpdateMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "Got ExtendedNavUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ),
+                                      std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ),
+                                      std::get<5>( mContent.mMsg ), static_cast<int>( std::get<9>( mContent.mMsg ) ),
+                                      std::get<10>( mContent.mMsg ) );
+}
+
+void ExtendedNavUpdateMsg::sendOut( SerialLink& link )
+{
+    // RPi0 never sends this
+
+    output2cout( "Error: RPi0 sending ExtendedNavUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ),
+                 std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ),
+                 std::get<5>( mContent.mMsg ), static_cast<int>( std::get<9>( mContent.mMsg ) ),
+                 std::get<10>( mContent.mMsg ) );
+}
+
+void ExtendedNavUpdateMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        mNeedsAction = false;
+
+        output2cout( "Got ExtendedNavUpdateMsg (hdg, roll, pitch, yaw rate, calib, time)",
+                     getIdNum(), TelemetryUnits::rawAngleToDegrees( std::get<0>( mContent.mMsg ) ),
+                     TelemetryUnits::rawAngleToDegrees( std::get<1>( mContent.mMsg ) ),
+                     TelemetryUnits::rawAngleToDegrees( std::get<2>( mContent.mMsg ) ),
+                     TelemetryUnits::rawGyroToDps( std::get<5>( mContent.mMsg ) ),
+                     static_cast<int>( std::get<9>( mContent.mMsg ) ), std::get<10>( mContent.mMsg ) );
+    }
+}
+
+/*********************************************************************************************/
+
+PoseUpdateMsg::PoseUpdateMsg() noexcept
+    : SerialMessage( MsgId::kPoseUpdate ),
+      mContent( MsgId::kPoseUpdate ),
+      mNeedsAction{ false }
+{}
+
+PoseUpdateMsg::PoseUpdateMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kPoseUpdate ),
+      mContent( MsgId::kPoseUpdate, t ),
+      mNeedsAction{ true }
+{}
+
+PoseUpdateMsg::PoseUpdateMsg( std::int32_t x, std::int32_t y, std::int16_t rawHeading,
+                              std::uint32_t time ) noexcept
+    : SerialMessage( MsgId::kPoseUpdate ),
+      mContent( MsgId::kPoseUpdate, std::make_tuple( x, y, rawHeading, time ) ),
+      mNeedsAction{ true }
+{}
+
+PoseUpdateMsg::PoseUpdateMsg( MsgId id )
+    : SerialMessage( MsgId::kPoseUpdate ),
+      mContent( MsgId::kPoseUpdate ),
+      mNeedsAction{ false }
+{
+    if ( id != MsgId::kPoseUpdate )
+    {
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1,
+                                           std::to_underlying( MsgId::kPoseUpdate ) ),
+                          "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void PoseUpdateMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "Got PoseUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ),
+                                      std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ),
+                                      std::get<3>( mContent.mMsg ) );
+}
+
+void PoseUpdateMsg::sendOut( SerialLink& link )
+{
+    // RPi0 never sends this
+
+    output2cout( "Error: RPi0 sending PoseUpdateMsg", getIdNum(), std::get<0>( mContent.mMsg ),
+                 std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ),
+                 std::get<3>( mContent.mMsg ) );
+}
+
+void PoseUpdateMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        mNeedsAction = false;
+
+        output2cout( "Got PoseUpdateMsg (x, y edges, hdg, time)", getIdNum(), getX(), getY(),
+                     getHeading(), std::get<3>( mContent.mMsg ) );
     }
 }
 
@@ -951,11 +1173,14 @@ NavUpdateControlMsg::NavUpdateControlMsg( TheData t ) noexcept
       mNeedsAction{ true }
 {}
 
-NavUpdateControlMsg::NavUpdateControlMsg( bool wantNavUpdates, bool wantNavStatus ) noexcept
+NavUpdateControlMsg::NavUpdateControlMsg( bool wantNavUpdates, bool wantNavStatus,
+                                          bool wantExtendedNav, bool wantPose ) noexcept
     : SerialMessage( MsgId::kNavUpdateControl ),
       mContent( MsgId::kNavUpdateControl,
                 std::make_tuple( static_cast<std::uint8_t>( wantNavUpdates ),
-                                 static_cast<std::uint8_t>( wantNavStatus ) ) ),
+                                 static_cast<std::uint8_t>( wantNavStatus ),
+                                 static_cast<std::uint8_t>( wantExtendedNav ),
+                                 static_cast<std::uint8_t>( wantPose ) ) ),
       mNeedsAction{ true }
 {}
 
@@ -978,7 +1203,9 @@ void NavUpdateControlMsg::readIn( SerialLink& link )
 
     output2cout( "Error: RPi0 got NavUpdateControlMsg", getIdNum(),
                  static_cast<bool>( std::get<0>( mContent.mMsg ) ),
-                 static_cast<bool>( std::get<1>( mContent.mMsg ) ) );
+                 static_cast<bool>( std::get<1>( mContent.mMsg ) ),
+                 static_cast<bool>( std::get<2>( mContent.mMsg ) ),
+                 static_cast<bool>( std::get<3>( mContent.mMsg ) ) );
 }
 
 void NavUpdateControlMsg::sendOut( SerialLink& link )
@@ -987,7 +1214,9 @@ void NavUpdateControlMsg::sendOut( SerialLink& link )
 
     debugCond2cout<kDebugSerialMsgs>( "NavUpdateControlMsg sent to Pico",
                                       static_cast<bool>( std::get<0>( mContent.mMsg ) ),
-                                      static_cast<bool>( std::get<1>( mContent.mMsg ) ) );
+                                      static_cast<bool>( std::get<1>( mContent.mMsg ) ),
+                                      static_cast<bool>( std::get<2>( mContent.mMsg ) ),
+                                      static_cast<bool>( std::get<3>( mContent.mMsg ) ) );
 }
 
 void NavUpdateControlMsg::takeAction( EventManager&, SerialLink& link )
@@ -1002,6 +1231,64 @@ void NavUpdateControlMsg::takeAction( EventManager&, SerialLink& link )
 
 /*********************************************************************************************/
 
+NavRateControlMsg::NavRateControlMsg() noexcept
+    : SerialMessage( MsgId::kNavRateControl ),
+      mContent( MsgId::kNavRateControl ),
+      mNeedsAction{ false }
+{}
+
+NavRateControlMsg::NavRateControlMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kNavRateControl ),
+      mContent( MsgId::kNavRateControl, t ),
+      mNeedsAction{ true }
+{}
+
+NavRateControlMsg::NavRateControlMsg( std::uint8_t hz ) noexcept
+    : SerialMessage( MsgId::kNavRateControl ),
+      mContent( MsgId::kNavRateControl, std::make_tuple( hz ) ),
+      mNeedsAction{ true }
+{}
+
+NavRateControlMsg::NavRateControlMsg( MsgId id )
+    : SerialMessage( id ), mContent( MsgId::kNavRateControl ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kNavRateControl )
+    {
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1,
+                                           std::to_underlying( MsgId::kNavRateControl ) ),
+                          "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void NavRateControlMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = false;
+
+    output2cout( "Error: RPi0 got NavRateControlMsg",
+                 static_cast<int>( std::get<0>( mContent.mMsg ) ) );
+}
+
+void NavRateControlMsg::sendOut( SerialLink& link )
+{
+    mContent.sendOut( link );
+
+    output2cout( "RPi0 sent NavRateControlMsg", static_cast<int>( std::get<0>( mContent.mMsg ) ) );
+}
+
+void NavRateControlMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        // This message should only be sent, not received
+        output2cout( "Error: Trying to takeAction() on local Msg", getIdNum() );
+        mNeedsAction = false;
+    }
+}
+
+/*********************************************************************************************/
+
 DrivingStatusUpdateMsg::DrivingStatusUpdateMsg() noexcept
     : SerialMessage( MsgId::kDrivingStatusUpdate ),
       mContent( MsgId::kDrivingStatusUpdate ),
@@ -1061,6 +1348,69 @@ void DrivingStatusUpdateMsg::takeAction( EventManager&, SerialLink& link )
 
 /*********************************************************************************************/
 
+ImpactControlMsg::ImpactControlMsg() noexcept
+    : SerialMessage( MsgId::kImpactControl ),
+      mContent( MsgId::kImpactControl ),
+      mNeedsAction{ false }
+{}
+
+ImpactControlMsg::ImpactControlMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kImpactControl ),
+      mContent( MsgId::kImpactControl, t ),
+      mNeedsAction{ true }
+{}
+
+ImpactControlMsg::ImpactControlMsg( bool enable, std::uint16_t accelThreshold,
+                                    std::uint16_t stallMs ) noexcept
+    : SerialMessage( MsgId::kImpactControl ),
+      mContent( MsgId::kImpactControl,
+                std::make_tuple( static_cast<std::uint8_t>( enable ), accelThreshold, stallMs ) ),
+      mNeedsAction{ true }
+{}
+
+ImpactControlMsg::ImpactControlMsg( MsgId id )
+    : SerialMessage( id ), mContent( MsgId::kImpactControl ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kImpactControl )
+    {
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1,
+                                           std::to_underlying( MsgId::kImpactControl ) ),
+                          "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void ImpactControlMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = false;
+
+    output2cout( "Error: RPi0 got ImpactControlMsg", getIdNum(),
+                 static_cast<bool>( std::get<0>( mContent.mMsg ) ), std::get<1>( mContent.mMsg ),
+                 std::get<2>( mContent.mMsg ) );
+}
+
+void ImpactControlMsg::sendOut( SerialLink& link )
+{
+    mContent.sendOut( link );
+
+    debugCond2cout<kDebugSerialMsgs>( "RPi0 sent ImpactControlMsg", getIdNum(),
+                                      static_cast<bool>( std::get<0>( mContent.mMsg ) ),
+                                      std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ) );
+}
+
+void ImpactControlMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        // This message should only be sent, not received
+        output2cout( "Error: Trying to takeAction() on local Msg", getIdNum() );
+        mNeedsAction = false;
+    }
+}
+
+/*********************************************************************************************/
+
 EncoderUpdateMsg::EncoderUpdateMsg() noexcept
     : SerialMessage( MsgId::kEncoderUpdate ),
       mContent( MsgId::kEncoderUpdate ),
@@ -1073,9 +1423,12 @@ EncoderUpdateMsg::EncoderUpdateMsg( TheData t ) noexcept
       mNeedsAction{ true }
 {}
 
-EncoderUpdateMsg::EncoderUpdateMsg( Side side, int count, std::uint32_t time ) noexcept
+EncoderUpdateMsg::EncoderUpdateMsg( std::uint16_t leftSpeed, std::uint16_t rightSpeed,
+                                    std::uint32_t leftDistance, std::uint32_t rightDistance,
+                                    std::uint32_t time ) noexcept
     : SerialMessage( MsgId::kEncoderUpdate ),
-      mContent( MsgId::kEncoderUpdate, std::make_tuple( std::to_underlying( side ), count, time ) ),
+      mContent( MsgId::kEncoderUpdate, std::make_tuple( leftSpeed, rightSpeed, leftDistance,
+                                                        rightDistance, time ) ),
       mNeedsAction{ true }
 {}
 
@@ -1097,7 +1450,8 @@ void EncoderUpdateMsg::readIn( SerialLink& link )
     mNeedsAction = true;
 
     debugCond2cout<kDebugSerialMsgs>( "RPi0 got EncoderUpdateMsg", std::get<0>( mContent.mMsg ),
-                                      std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ) );
+                                      std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ),
+                                      std::get<3>( mContent.mMsg ), std::get<4>( mContent.mMsg ) );
 }
 
 void EncoderUpdateMsg::sendOut( SerialLink& link )
@@ -1105,7 +1459,8 @@ void EncoderUpdateMsg::sendOut( SerialLink& link )
     // RPi0 never sends this
 
     output2cout( "Error: RPi0 sends EncoderUpdateMsg", std::get<0>( mContent.mMsg ),
-                 std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ) );
+                 std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ),
+                 std::get<3>( mContent.mMsg ), std::get<4>( mContent.mMsg ) );
 }
 
 void EncoderUpdateMsg::takeAction( EventManager&, SerialLink& link )
@@ -1116,9 +1471,9 @@ void EncoderUpdateMsg::takeAction( EventManager&, SerialLink& link )
         // TODO
         mNeedsAction = false;
 
-        output2cout( "Got EncoderUpdateMsg", getIdNum(),
-                     ( static_cast<bool>( std::get<0>( mContent.mMsg ) ) ? "Right" : "Left" ),
-                     std::get<1>( mContent.mMsg ), std::get<2>( mContent.mMsg ) );
+        output2cout( "Got EncoderUpdateMsg", getIdNum(), "L:", getLeftSpeed(),
+                     std::get<2>( mContent.mMsg ), "R:", getRightSpeed(),
+                     std::get<3>( mContent.mMsg ), std::get<4>( mContent.mMsg ) );
     }
 }
 
@@ -1255,10 +1610,11 @@ BatteryLevelUpdateMsg::BatteryLevelUpdateMsg( TheData t ) noexcept
       mNeedsAction{ true }
 {}
 
-BatteryLevelUpdateMsg::BatteryLevelUpdateMsg( Battery whichBattery, float level ) noexcept
+BatteryLevelUpdateMsg::BatteryLevelUpdateMsg( Battery whichBattery,
+                                              std::uint16_t rawCounts ) noexcept
     : SerialMessage( MsgId::kBatteryLevelUpdate ),
       mContent( MsgId::kBatteryLevelUpdate,
-                std::make_tuple( std::to_underlying( whichBattery ), level ) ),
+                std::make_tuple( std::to_underlying( whichBattery ), rawCounts ) ),
       mNeedsAction{ true }
 {}
 
@@ -1301,7 +1657,197 @@ void BatteryLevelUpdateMsg::takeAction( EventManager&, SerialLink& link )
 
         output2cout( "Got BatteryLevelUpdateMsg", getIdNum(),
                      ( static_cast<bool>( std::get<0>( mContent.mMsg ) ) ? "Motor" : "IC" ),
-                     std::get<1>( mContent.mMsg ) );
+                     getVolts(), std::get<1>( mContent.mMsg ) );
+    }
+}
+
+/*********************************************************************************************/
+
+EventStatsRequestMsg::EventStatsRequestMsg() noexcept
+    : SerialMessage( MsgId::kEventStatsRequest ),
+      mContent( MsgId::kEventStatsRequest ),
+      mNeedsAction{ false }
+{}
+
+EventStatsRequestMsg::EventStatsRequestMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kEventStatsRequest ),
+      mContent( MsgId::kEventStatsRequest, t ),
+      mNeedsAction{ true }
+{}
+
+EventStatsRequestMsg::EventStatsRequestMsg( bool resetAfter ) noexcept
+    : SerialMessage( MsgId::kEventStatsRequest ),
+      mContent( MsgId::kEventStatsRequest,
+                std::make_tuple( static_cast<std::uint8_t>( resetAfter ) ) ),
+      mNeedsAction{ true }
+{}
+
+EventStatsRequestMsg::EventStatsRequestMsg( MsgId id )
+    : SerialMessage( id ), mContent( MsgId::kEventStatsRequest ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kEventStatsRequest )
+    {
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1,
+                                           std::to_underlying( MsgId::kEventStatsRequest ) ),
+                          "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void EventStatsRequestMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = false;
+
+    output2cout( "Error: RPi0 got EventStatsRequestMsg",
+                 static_cast<int>( std::get<0>( mContent.mMsg ) ) );
+}
+
+void EventStatsRequestMsg::sendOut( SerialLink& link )
+{
+    mContent.sendOut( link );
+
+    output2cout( "RPi0 sent EventStatsRequestMsg",
+                 static_cast<int>( std::get<0>( mContent.mMsg ) ) );
+}
+
+void EventStatsRequestMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        // This message should only be sent, not received
+        output2cout( "Error: Trying to takeAction() on local Msg", getIdNum() );
+        mNeedsAction = false;
+    }
+}
+
+/*********************************************************************************************/
+
+EventStatsMsg::EventStatsMsg() noexcept
+    : SerialMessage( MsgId::kEventStats ), mContent( MsgId::kEventStats ), mNeedsAction{ false }
+{}
+
+EventStatsMsg::EventStatsMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kEventStats ),
+      mContent( MsgId::kEventStats, t ),
+      mNeedsAction{ true }
+{}
+
+EventStatsMsg::EventStatsMsg( std::uint8_t evtId, EventStatsKind kind, std::uint32_t maxUs,
+                              const EventStatsCounts& counts ) noexcept
+    : SerialMessage( MsgId::kEventStats ),
+      mContent( MsgId::kEventStats,
+                std::tuple_cat( std::make_tuple( evtId, std::to_underlying( kind ), maxUs ),
+                                counts ) ),
+      mNeedsAction{ true }
+{}
+
+EventStatsMsg::EventStatsMsg( MsgId id )
+    : SerialMessage( id ), mContent( MsgId::kEventStats ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kEventStats )
+    {
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1,
+                                           std::to_underlying( MsgId::kEventStats ) ),
+                          "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void EventStatsMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "RPi0 got EventStatsMsg", getIdNum(),
+                                      static_cast<int>( std::get<0>( mContent.mMsg ) ),
+                                      static_cast<int>( std::get<1>( mContent.mMsg ) ),
+                                      std::get<2>( mContent.mMsg ) );
+}
+
+void EventStatsMsg::sendOut( SerialLink& link )
+{
+    // RPi0 never sends this
+
+    output2cout( "Error: RPi0 sending EventStatsMsg", getIdNum(),
+                 static_cast<int>( std::get<0>( mContent.mMsg ) ) );
+}
+
+void EventStatsMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        mNeedsAction = false;
+
+        EventStatsCounts c{ getCounts() };
+        output2cout( "Got EventStatsMsg", getIdNum(), "evt",
+                     static_cast<int>( std::get<0>( mContent.mMsg ) ),
+                     ( std::get<1>( mContent.mMsg ) ? "exec" : "latency" ), "max us",
+                     std::get<2>( mContent.mMsg ), "counts", c[ 0 ], c[ 1 ], c[ 2 ], c[ 3 ],
+                     c[ 4 ], c[ 5 ], c[ 6 ], c[ 7 ] );
+    }
+}
+
+/*********************************************************************************************/
+
+MemoryStatsMsg::MemoryStatsMsg() noexcept
+    : SerialMessage( MsgId::kMemoryStats ), mContent( MsgId::kMemoryStats ), mNeedsAction{ false }
+{}
+
+MemoryStatsMsg::MemoryStatsMsg( TheData t ) noexcept
+    : SerialMessage( MsgId::kMemoryStats ),
+      mContent( MsgId::kMemoryStats, t ),
+      mNeedsAction{ true }
+{}
+
+MemoryStatsMsg::MemoryStatsMsg( std::uint32_t heapUsed, std::uint32_t heapHighWater,
+                                std::uint32_t heapFree, std::uint16_t core0StackFree,
+                                std::uint16_t core1StackFree, std::uint32_t time ) noexcept
+    : SerialMessage( MsgId::kMemoryStats ),
+      mContent( MsgId::kMemoryStats, std::make_tuple( heapUsed, heapHighWater, heapFree,
+                                                      core0StackFree, core1StackFree, time ) ),
+      mNeedsAction{ true }
+{}
+
+MemoryStatsMsg::MemoryStatsMsg( MsgId id )
+    : SerialMessage( id ), mContent( MsgId::kMemoryStats ), mNeedsAction{ false }
+{
+    if ( id != MsgId::kMemoryStats )
+    {
+        throw CarrtError( makeRpi0ErrorId( kRPi0SerialMessageError, 1,
+                                           std::to_underlying( MsgId::kMemoryStats ) ),
+                          "Id mismatch at creation" );
+    }
+    // Note that it doesn't need action until loaded with data
+}
+
+void MemoryStatsMsg::readIn( SerialLink& link )
+{
+    mContent.readIn( link );
+    mNeedsAction = true;
+
+    debugCond2cout<kDebugSerialMsgs>( "RPi0 got MemoryStatsMsg", getIdNum(),
+                                      std::get<0>( mContent.mMsg ), std::get<1>( mContent.mMsg ),
+                                      std::get<2>( mContent.mMsg ) );
+}
+
+void MemoryStatsMsg::sendOut( SerialLink& link )
+{
+    // RPi0 never sends this
+
+    output2cout( "Error: RPi0 sending MemoryStatsMsg", getIdNum() );
+}
+
+void MemoryStatsMsg::takeAction( EventManager&, SerialLink& link )
+{
+    if ( mNeedsAction )
+    {
+        mNeedsAction = false;
+
+        output2cout( "Got MemoryStatsMsg", getIdNum(), "heap used", std::get<0>( mContent.mMsg ),
+                     "high water", std::get<1>( mContent.mMsg ), "free",
+                     std::get<2>( mContent.mMsg ), "stack free", std::get<3>( mContent.mMsg ),
+                     std::get<4>( mContent.mMsg ), "at", std::get<5>( mContent.mMsg ) );
     }
 }
 
@@ -51,7 +51,7 @@ int main()
 
     std::cout << "Serial link test" << std::endl;
 
-    SerialMessageProcessor smp( 32, pico );
+    SerialMessageProcessor smp( pico );
     smp.registerMessage<TimerEventMsg>( MsgId::kTimerEventMsg );
     smp.registerMessage<TimerControlMsg>( MsgId::kTimerControl );
     smp.registerMessage<ErrorReportMsg>( MsgId::kErrorReportFromPico );
@@ -20,10 +20,34 @@
 #ifndef CarrtError_h
 #define CarrtError_h
 
+#include <exception>
 #include <stdexcept>
+#include <string>
 
 #include "ErrorCodes.h"
 
+#if BUILDING_FOR_PICO
+
+// On the Pico what() is always a string literal, so keep just the pointer
+// rather than have std::runtime_error copy it to the heap
+class CarrtError : public std::exception
+{
+public:
+    explicit CarrtError( int errCode, const char* what ) noexcept
+        : mWhat( what ), mErrorCode( errCode )
+    {}
+
+    const char* what() const noexcept override { return mWhat; }
+
+    int errorCode() const { return mErrorCode; }
+
+private:
+    const char* mWhat;
+    int mErrorCode;
+};
+
+#else
+
 class CarrtError : public std::runtime_error
 {
 public:
@@ -41,6 +65,38 @@ private:
     int mErrorCode;
 };
 
+#endif    // BUILDING_FOR_PICO
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Every CARRT error is fatal, so code raises them through this rather than
+// throwing directly.  A Pico built without exceptions has nothing to unwind
+// to, so instead carrtFatalError() sends the same fatal ErrorReportMsg
+// main() would and waits for a reset.
+
+#if BUILDING_FOR_PICO && !defined( CARRTPICO_ENABLE_EXCEPTIONS )
+    #define CARRTPICO_ENABLE_EXCEPTIONS 1
+#endif    // CARRTPICO_ENABLE_EXCEPTIONS
+
+#if BUILDING_FOR_PICO && !CARRTPICO_ENABLE_EXCEPTIONS
+
+// Defined alongside main() (CarrtPicoMain.cpp); only call from Core0
+[[noreturn]] void carrtFatalError( int errCode, const char* what ) noexcept;
+
+[[noreturn]] inline void raiseCarrtError( int errCode, const char* what ) noexcept
+{
+    carrtFatalError( errCode, what );
+}
+
+#else
+
+[[noreturn]] inline void raiseCarrtError( int errCode, const char* what )
+{
+    throw CarrtError( errCode, what );
+}
+
+#endif    // BUILDING_FOR_PICO && !CARRTPICO_ENABLE_EXCEPTIONS
+
 ////////////////////////////////////////////////////////////////////////////////
 
 inline int makeRpi0ErrorId( int moduleId, int functionId, int error )
@@ -85,6 +85,9 @@ enum PicoError : int
     kPicoMainProcessError       = 4,
     kPicoSerialMessageError     = 5,
     kPicoEventProcessorError    = 6,
+    kPicoNavRateError           = 7,
+    kPicoMemoryError            = 8,
+    kPicoConfigStoreError       = 9,
 
     kPicoCritSectionError       = 10,
 
@@ -117,7 +120,9 @@ enum CommonError : int
     kSerialMsgReadError         = 80,
     kSerialMsgDupeError         = 81,
     kSerialMsgUnknownError      = 82,
-    kEventHandlerDupeError      = 83
+    kEventHandlerDupeError      = 83,
+    kEventHandlerRangeError     = 84,
+    kSerialMsgSlotBusyError     = 85
 };
 
 #endif    // ErrorCodes.h
@@ -44,3 +44,28 @@ std::optional<float> SerialLink::getFloat()
     else
         return std::nullopt;
 }
+
+std::optional<std::int16_t> SerialLink::getInt16()
+{
+    std::array<std::uint8_t, 2> c;
+    for ( auto& byte : c )
+    {
+        auto got = getByte();
+        if ( !got )
+        {
+            return std::nullopt;
+        }
+        byte = *got;
+    }
+    return std::bit_cast<std::int16_t>( c );
+}
+
+std::optional<std::uint16_t> SerialLink::getUint16()
+{
+    auto got = getInt16();
+    if ( !got )
+    {
+        return std::nullopt;
+    }
+    return std::bit_cast<std::uint16_t>( *got );
+}
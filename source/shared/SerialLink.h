@@ -124,9 +124,17 @@ public:
 
     std::optional<float> getFloat();
 
+    std::optional<std::int16_t> getInt16();
+
+    std::optional<std::uint16_t> getUint16();
+
     // Reading overloaded functions
     std::optional<std::uint8_t> get( std::uint8_t ) { return getByte(); }
 
+    std::optional<std::int16_t> get( std::int16_t ) { return getInt16(); }
+
+    std::optional<std::uint16_t> get( std::uint16_t ) { return getUint16(); }
+
     std::optional<int> get( int ) { return getInt(); }
 
     std::optional<std::uint32_t> get( std::uint32_t ) { return getUInt32(); }
@@ -149,6 +157,18 @@ public:
 
     inline void put( std::uint8_t c ) { putByte( c ); }
 
+    inline void put( std::int16_t i )
+    {
+        auto c{ std::bit_cast<std::array<std::uint8_t, 2>>( i ) };
+        putByte( c[ 0 ] );
+        putByte( c[ 1 ] );
+    }
+
+    inline void put( std::uint16_t u )
+    {
+        put( std::bit_cast<std::int16_t>( u ) );
+    }
+
     inline void put( int i )
     {
         RawData r( i );
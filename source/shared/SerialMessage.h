@@ -22,6 +22,7 @@
 #ifndef SerialMessage_h
 #define SerialMessage_h
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <tuple>
@@ -67,6 +68,10 @@ enum class MsgId : std::uint8_t
     // kPicoReady)
     kResetPicoMsg,
 
+    // Pico to erase the configuration it saves in flash (msg controls, etc)
+    // and go back to its defaults (ack by sending kResetPicoConfig back)
+    kResetPicoConfig,
+
     /////// Timer events
 
     // Timer event (2nd byte -> 1 = 1/4s, 4 = 1s, 32 = 8s;
@@ -96,20 +101,51 @@ enum class MsgId : std::uint8_t
     // RPi to Pico message to reset BNO055
     kResetBNO055,
 
+    // Both ways: Pico sends the BNO055 calibration profile (11 std::int16_t:
+    // accel, mag, gyro offsets x-y-z, then accel and mag radius) each time
+    // the BNO055 becomes calibrated; RPi0 sends a stored one back so the
+    // Pico restores it whenever it initializes the BNO055
+    kCalibrationProfile,
+
     /////// Navigation events
 
-    // Navigation timer (1/8 sec) from Pico to RPi0 (info in following bytes)
+    // Navigation update (8 Hz unless changed by kNavRateControl) from Pico to
+    // RPi0 (raw BNO055 heading as std::int16_t in 1/16 deg, then time hack)
     kTimerNavUpdate,
 
+    // Extended navigation update (sent with kTimerNavUpdate when enabled by
+    // kNavUpdateControl) from Pico to RPi0: raw BNO055 heading, roll, pitch
+    // (1/16 deg), gyro x, y, z (1/16 deg/s), linear accel x, y, z (1/100
+    // m/s^2) as std::int16_t, packed calibration byte, and time hack
+    kExtendedNavUpdate,
+
+    // Dead reckoned pose (sent with kTimerNavUpdate when enabled by
+    // kNavUpdateControl) from Pico to RPi0: x (north), y (east) as
+    // std::int32_t (1/256 encoder edge), raw BNO055 heading as std::int16_t
+    // (1/16 deg), and time hack
+    kPoseUpdate,
+
     // From RPi0 to Pico to start/stop sending of NavUpdates
-    // (2nd byte -> 0/1 = stop/start)
+    // (2nd byte -> 0/1 = stop/start; 3rd byte nav status updates;
+    // 4th byte extended nav updates; 5th byte pose updates)
     kNavUpdateControl,
 
+    // From RPi0 to Pico to set the nav update rate (2nd byte -> Hz);
+    // Pico replies with an error report if it had to change the rate
+    kNavRateControl,
+
     // From RPi0 to Pico (2nd byte provides driving status)
     kDrivingStatusUpdate,
 
-    // From Pico to RPi0, 2nd byte = L count; 3rd byte = R count; followed by
-    // time hack
+    // From RPi0 to Pico to configure impact detection (2nd byte -> 0/1 =
+    // off/on; then std::uint16_t linear accel threshold (raw BNO055, 100
+    // LSB = 1 m/s^2) and std::uint16_t wheel stall time in ms; 0 turns
+    // either check off).  Pico sends kPicoSaysStop when one trips.
+    kImpactControl,
+
+    // From Pico to RPi0, once per nav update: L and R wheel speeds (raw,
+    // see TelemetryUnits) as std::uint16_t, L and R distances (edges since
+    // the Pico started) as std::uint32_t, then time hack
     kEncoderUpdate,
 
     // From RPi0 to Pico to start/stop sending of encoder udpates
@@ -122,10 +158,27 @@ enum class MsgId : std::uint8_t
     // 0 = IC, 1 = Motor)
     kBatteryLevelRequest,
 
-    // Pico to RPi0 battery V; 2nd byte = which battery; following 4 bytes
-    // voltage (float)
+    // Pico to RPi0 battery V; 2nd byte = which battery; following 2 bytes
+    // raw ADC counts (std::uint16_t, see TelemetryUnits.h)
     kBatteryLevelUpdate,
 
+    /////// Profiling
+
+    // From RPi0 to Pico requesting event-loop timing histograms (2nd byte
+    // -> 0/1 = keep/reset the histograms after sending them)
+    kEventStatsRequest,
+
+    // Pico to RPi0, one per EvtId seen and kind of timing: 2nd byte EvtId,
+    // 3rd byte kind (0 = queue latency, 1 = handler execution), then max us
+    // and 8 bucket counts (all std::uint32_t)
+    kEventStats,
+
+    // Pico to RPi0 whenever a memory watermark gets worse: heap bytes in
+    // use, heap bytes malloc has claimed, and heap bytes still available
+    // (std::uint32_t), then Core0 and Core1 stack bytes never touched
+    // (std::uint16_t), then time hack
+    kMemoryStats,
+
     /////// Error reports
 
     // Pico sends a bool fatal flag (bool in a std::uint8_t) and error code
@@ -173,10 +226,27 @@ inline constexpr bool is_tuple_v<std::tuple<Elems...>> = true;
 template<typename T>
 concept IsTuple = is_tuple_v<std::remove_cvref_t<T>>;
 
+// Bytes each item occupies on the serial link (bool goes out via put( int ))
+template<typename T>
+inline constexpr std::size_t kSerialWireSize = sizeof( T );
+
+template<>
+inline constexpr std::size_t kSerialWireSize<bool> = sizeof( int );
+
+template<typename T>
+inline constexpr std::size_t kTupleWireSize = 0;
+
+template<typename... Elems>
+inline constexpr std::size_t kTupleWireSize<std::tuple<Elems...>>
+    = ( std::size_t{ 0 } + ... + kSerialWireSize<Elems> );
+
 template<IsTuple TTuple>
 struct RawMessage
 {
 public:
+    // Size of the message on the serial link, including the MsgId byte
+    static constexpr std::size_t kWireSize{ 1 + kTupleWireSize<TTuple> };
+
     explicit RawMessage( MsgId id ) noexcept
         : mId{ id }, mMsg{}
     {}
@@ -199,8 +269,8 @@ public:
                 }
                 else
                 {
-                    throw CarrtError( makeSharedErrorId( kSerialMsgReadError, 1, 1 ),
-                                      "Couldn't read serial message in lamba" );
+                    raiseCarrtError( makeSharedErrorId( kSerialMsgReadError, 1, 1 ),
+                                     "Couldn't read serial message in lamba" );
                 }
             },
             link );
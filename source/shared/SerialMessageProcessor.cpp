@@ -23,10 +23,8 @@
 #include "SerialLink.h"
 #include "SerialMessage.h"
 
-MessageFactory::MessageFactory( int reserveSize ) { mCreators.reserve( reserveSize ); }
-
-SerialMessageProcessor::SerialMessageProcessor( int reserveSize, SerialLink& link )
-    : mFactory{ reserveSize }, mLink{ link }
+SerialMessageProcessor::SerialMessageProcessor( SerialLink& link )
+    : mFactory{}, mLink{ link }
 {
     // Nothing else to do
 }
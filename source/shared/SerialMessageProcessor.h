@@ -21,20 +21,81 @@
 #ifndef SerialMessageProcessor_h
 #define SerialMessageProcessor_h
 
+#include <array>
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <string>
-#include <unordered_map>
 
 #include "CarrtError.h"
 #include "OutputUtils.hpp"
 #include "SerialMessage.h"
 
+// Largest message (in bytes) the Pico can receive; registerMessage()
+// refuses at compile time any that won't fit
+#ifndef SERIALMESSAGEPROCESSOR_MSG_SLOT_SIZE
+    #define SERIALMESSAGEPROCESSOR_MSG_SLOT_SIZE 64
+#endif    // SERIALMESSAGEPROCESSOR_MSG_SLOT_SIZE
+
+namespace SerialMessageInternal
+{
+
+#if BUILDING_FOR_PICO
+
+    // The Pico reads, acts on, and discards one incoming message at a time,
+    // so every message is built in the same static slot instead of on the
+    // heap.  The deleter just runs the destructor and frees the slot.
+    inline constexpr std::size_t kMsgSlotSize{ SERIALMESSAGEPROCESSOR_MSG_SLOT_SIZE };
+
+    alignas( std::max_align_t ) inline std::byte sMsgSlot[ kMsgSlotSize ];
+    inline bool sMsgSlotInUse{ false };
+
+    struct MsgDeleter
+    {
+        void operator()( SerialMessage* msg ) const noexcept
+        {
+            msg->~SerialMessage();
+            sMsgSlotInUse = false;
+        }
+    };
+
+    template<typename T, typename... Args>
+    std::unique_ptr<SerialMessage, MsgDeleter> makeMsg( Args&&... args )
+    {
+        static_assert( sizeof( T ) <= kMsgSlotSize && alignof( T ) <= alignof( std::max_align_t ),
+                       "Message too big for the Pico's message slot "
+                       "(see SERIALMESSAGEPROCESSOR_MSG_SLOT_SIZE)" );
+        if ( sMsgSlotInUse )
+        {
+            // Someone held on to the previous message
+            raiseCarrtError( makeSharedErrorId( kSerialMsgSlotBusyError, 1, 0 ),
+                             "Msg slot still in use" );
+        }
+        T* msg{ new ( sMsgSlot ) T( std::forward<Args>( args )... ) };
+        sMsgSlotInUse = true;
+        return std::unique_ptr<SerialMessage, MsgDeleter>( msg );
+    }
+
+#else
+
+    using MsgDeleter = std::default_delete<SerialMessage>;
+
+    template<typename T, typename... Args>
+    std::unique_ptr<SerialMessage, MsgDeleter> makeMsg( Args&&... args )
+    {
+        return std::unique_ptr<SerialMessage, MsgDeleter>( new T( std::forward<Args>( args )... ) );
+    }
+
+#endif    // BUILDING_FOR_PICO
+
+}    // namespace SerialMessageInternal
+
 class MessageFactory
 {
 public:
-    using MsgPtr = typename std::unique_ptr<SerialMessage>;
+    using MsgPtr = typename std::unique_ptr<SerialMessage, SerialMessageInternal::MsgDeleter>;
 
-    explicit MessageFactory( int reserveSize );
+    MessageFactory() = default;
     ~MessageFactory() = default;
 
     MessageFactory( const MessageFactory& ) = delete;
@@ -49,32 +110,33 @@ public:
                        "MessageFactory::registerMessage(): Messages must "
                        "derive from SerialMessage" );
         std::uint8_t idNum = std::to_underlying( id );
-        if ( mCreators.find( idNum ) != mCreators.end() )
+        if ( mCreators[ idNum ] )
         {
             // Need to throw because incoming serial stream can be corrupt from
             // this point onward
-            throw CarrtError( makeSharedErrorId( kSerialMsgDupeError, 1, idNum ),
-                              "Id dupe at registation" );
+            raiseCarrtError( makeSharedErrorId( kSerialMsgDupeError, 1, idNum ),
+                             "Id dupe at registation" );
         }
         mCreators[ idNum ] = &creator<T>;
+        ++mNbrRegistered;
     }
 
     MsgPtr createMessage( MsgId id )
     {
-        if ( mCreators.empty() )
+        if ( mNbrRegistered == 0 )
         {
             // Behave like a straight dump to output
-            return MsgPtr( new DumpByteMsg( id ) );
+            return SerialMessageInternal::makeMsg<DumpByteMsg>( id );
         }
-        auto it = mCreators.find( std::to_underlying( id ) );
-        if ( it != mCreators.end() )
+        PCreator creator{ mCreators[ std::to_underlying( id ) ] };
+        if ( creator )
         {
-            return it->second( id );
+            return creator( id );
         }
         // If we cannot find the id, return a special message, UnknownMsg.
         output2cout( "Unknown msg received", static_cast<int>( id ) );
         int err = makeSharedErrorId( kSerialMsgUnknownError, 1, std::to_underlying( id ) );
-        return std::unique_ptr<SerialMessage>( new UnknownMsg( std::to_underlying( id ), err ) );
+        return SerialMessageInternal::makeMsg<UnknownMsg>( std::to_underlying( id ), err );
     }
 
 private:
@@ -83,11 +145,14 @@ private:
     {
         // All SerialMessages must have a constructor that takes a MsgId
         // parameter (the ID)
-        return MsgPtr( new T( id ) );
+        return SerialMessageInternal::makeMsg<T>( id );
     }
 
     using PCreator = MsgPtr ( * )( MsgId );
-    std::unordered_map<std::uint8_t, PCreator> mCreators;
+
+    // MsgIds are a byte, so a table indexed by id covers them all
+    std::array<PCreator, 256> mCreators{};
+    int mNbrRegistered{ 0 };
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -99,7 +164,7 @@ class SerialMessageProcessor
 public:
     using MsgPtr = typename MessageFactory::MsgPtr;
 
-    SerialMessageProcessor( int reserveSize, SerialLink& link );
+    explicit SerialMessageProcessor( SerialLink& link );
 
     ~SerialMessageProcessor() = default;
 
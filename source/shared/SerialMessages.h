@@ -22,9 +22,15 @@
 #ifndef SerialMessages_h
 #define SerialMessages_h
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
 #include "CarrtError.h"
 #include "SerialLink.h"
 #include "SerialMessage.h"
+#include "TelemetryUnits.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -218,6 +224,17 @@ public:
 
 ////////////////////////////////////////////////////////////////////////////////
 
+class ResetPicoConfigMsg : public NoContentMsg
+{
+public:
+    ResetPicoConfigMsg() noexcept;
+    explicit ResetPicoConfigMsg( MsgId id ) noexcept;
+
+    virtual void takeAction( EventManager& events, SerialLink& link ) override;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 class TimerEventMsg : public SerialMessage
 {
 public:
@@ -381,16 +398,148 @@ public:
 
 ////////////////////////////////////////////////////////////////////////////////
 
+class CalibrationProfileMsg : public SerialMessage
+{
+public:
+    // Same layout as BNO055::CalibrationProfile
+    using Profile = std::array<std::int16_t, 11>;
+
+    using TheData = std::tuple<std::int16_t, std::int16_t, std::int16_t, std::int16_t,
+                               std::int16_t, std::int16_t, std::int16_t, std::int16_t,
+                               std::int16_t, std::int16_t, std::int16_t>;
+
+    CalibrationProfileMsg() noexcept;
+    explicit CalibrationProfileMsg( TheData t ) noexcept;
+    explicit CalibrationProfileMsg( const Profile& profile ) noexcept;
+    explicit CalibrationProfileMsg( MsgId id );
+
+    virtual void readIn( SerialLink& link ) override;
+
+    virtual void sendOut( SerialLink& link ) override;
+
+    virtual void takeAction( EventManager& events, SerialLink& link ) override;
+
+    [[nodiscard]] virtual bool needsAction() const noexcept override { return mNeedsAction; }
+
+    virtual MsgId getId() const noexcept override { return mContent.mId; }
+
+    Profile getProfile() const noexcept
+    {
+        return std::apply( []( auto... values ) { return Profile{ values... }; },
+                           mContent.mMsg );
+    }
+
+private:
+    struct RawMessage<TheData> mContent;
+
+    bool mNeedsAction;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 class NavUpdateMsg : public SerialMessage
 {
 public:
-    using TheData = std::tuple<float, std::uint32_t>;
+    // Heading in raw BNO055 units (see TelemetryUnits.h) and time hack
+    using TheData = std::tuple<std::int16_t, std::uint32_t>;
+
+    static constexpr std::size_t kWireSize{ RawMessage<TheData>::kWireSize };
 
     NavUpdateMsg() noexcept;
     explicit NavUpdateMsg( TheData t ) noexcept;
-    NavUpdateMsg( float heading, std::uint32_t time ) noexcept;
+    NavUpdateMsg( std::int16_t rawHeading, std::uint32_t time ) noexcept;
     explicit NavUpdateMsg( MsgId id );
 
+    float getHeading() const noexcept
+    {
+        return TelemetryUnits::rawAngleToDegrees( std::get<0>( mContent.mMsg ) );
+    }
+
+    virtual void readIn( SerialLink& link ) override;
+
+    virtual void sendOut( SerialLink& link ) override;
+
+    virtual void takeAction( EventManager& events, SerialLink& link ) override;
+
+    [[nodiscard]] virtual bool needsAction() const noexcept override { return mNeedsAction; }
+
+    virtual MsgId getId() const noexcept override { return mContent.mId; }
+
+private:
+    struct RawMessage<TheData> mContent;
+
+    bool mNeedsAction;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class ExtendedNavUpdateMsg : public SerialMessage
+{
+public:
+    // Each triplet is in BNO055 register order: heading, roll, pitch;
+    // gyro x, y, z; linear accel x, y, z
+    using Triplet = std::array<std::int16_t, 3>;
+
+    using TheData = std::tuple<std::int16_t, std::int16_t, std::int16_t, std::int16_t,
+                               std::int16_t, std::int16_t, std::int16_t, std::int16_t,
+                               std::int16_t, std::uint8_t, std::uint32_t>;
+
+    static constexpr std::size_t kWireSize{ RawMessage<TheData>::kWireSize };
+
+    ExtendedNavUpdateMsg() noexcept;
+    explicit ExtendedNavUpdateMsg( TheData t ) noexcept;
+    ExtendedNavUpdateMsg( const Triplet& euler, const Triplet& gyro, const Triplet& linAccel,
+                          std::uint8_t calibration, std::uint32_t time ) noexcept;
+    explicit ExtendedNavUpdateMsg( MsgId id );
+
+    virtual void readIn( SerialLink& link ) override;
+
+    virtual void sendOut( SerialLink& link ) override;
+
+    virtual void takeAction( EventManager& events, SerialLink& link ) override;
+
+    [[nodiscard]] virtual bool needsAction() const noexcept override { return mNeedsAction; }
+
+    virtual MsgId getId() const noexcept override { return mContent.mId; }
+
+private:
+    struct RawMessage<TheData> mContent;
+
+    bool mNeedsAction;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class PoseUpdateMsg : public SerialMessage
+{
+public:
+    // Position in raw units (see TelemetryUnits.h), heading in raw BNO055
+    // units, and time hack
+    using TheData = std::tuple<std::int32_t, std::int32_t, std::int16_t, std::uint32_t>;
+
+    static constexpr std::size_t kWireSize{ RawMessage<TheData>::kWireSize };
+
+    PoseUpdateMsg() noexcept;
+    explicit PoseUpdateMsg( TheData t ) noexcept;
+    PoseUpdateMsg( std::int32_t x, std::int32_t y, std::int16_t rawHeading,
+                   std::uint32_t time ) noexcept;
+    explicit PoseUpdateMsg( MsgId id );
+
+    float getX() const noexcept
+    {
+        return TelemetryUnits::rawPositionToEdges( std::get<0>( mContent.mMsg ) );
+    }
+
+    float getY() const noexcept
+    {
+        return TelemetryUnits::rawPositionToEdges( std::get<1>( mContent.mMsg ) );
+    }
+
+    float getHeading() const noexcept
+    {
+        return TelemetryUnits::rawAngleToDegrees( std::get<2>( mContent.mMsg ) );
+    }
+
     virtual void readIn( SerialLink& link ) override;
 
     virtual void sendOut( SerialLink& link ) override;
@@ -412,11 +561,13 @@ private:
 class NavUpdateControlMsg : public SerialMessage
 {
 public:
-    using TheData = std::tuple<std::uint8_t, std::uint8_t>;
+    using TheData = std::tuple<std::uint8_t, std::uint8_t, std::uint8_t, std::uint8_t>;
 
     NavUpdateControlMsg() noexcept;
     explicit NavUpdateControlMsg( TheData t ) noexcept;
-    NavUpdateControlMsg( bool wantNavUpdate, bool wantNavStatusUpdate ) noexcept;
+    NavUpdateControlMsg( bool wantNavUpdate, bool wantNavStatusUpdate,
+                         bool wantExtendedNavUpdate = false,
+                         bool wantPoseUpdate = false ) noexcept;
     explicit NavUpdateControlMsg( MsgId id );
 
     virtual void readIn( SerialLink& link ) override;
@@ -437,6 +588,34 @@ private:
 
 ////////////////////////////////////////////////////////////////////////////////
 
+class NavRateControlMsg : public SerialMessage
+{
+public:
+    using TheData = std::tuple<std::uint8_t>;
+
+    NavRateControlMsg() noexcept;
+    explicit NavRateControlMsg( TheData t ) noexcept;
+    explicit NavRateControlMsg( std::uint8_t hz ) noexcept;
+    explicit NavRateControlMsg( MsgId id );
+
+    virtual void readIn( SerialLink& link ) override;
+
+    virtual void sendOut( SerialLink& link ) override;
+
+    virtual void takeAction( EventManager& events, SerialLink& link ) override;
+
+    [[nodiscard]] virtual bool needsAction() const noexcept override { return mNeedsAction; }
+
+    virtual MsgId getId() const noexcept override { return mContent.mId; }
+
+private:
+    struct RawMessage<TheData> mContent;
+
+    bool mNeedsAction;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 class DrivingStatusUpdateMsg : public SerialMessage
 {
 public:
@@ -474,22 +653,63 @@ private:
 
 ////////////////////////////////////////////////////////////////////////////////
 
+class ImpactControlMsg : public SerialMessage
+{
+public:
+    // On/off, linear accel threshold (raw BNO055 units, see TelemetryUnits),
+    // and wheel stall time (ms)
+    using TheData = std::tuple<std::uint8_t, std::uint16_t, std::uint16_t>;
+
+    ImpactControlMsg() noexcept;
+    explicit ImpactControlMsg( TheData t ) noexcept;
+    ImpactControlMsg( bool enable, std::uint16_t accelThreshold, std::uint16_t stallMs ) noexcept;
+    explicit ImpactControlMsg( MsgId id );
+
+    virtual void readIn( SerialLink& link ) override;
+
+    virtual void sendOut( SerialLink& link ) override;
+
+    virtual void takeAction( EventManager& events, SerialLink& link ) override;
+
+    [[nodiscard]] virtual bool needsAction() const noexcept override { return mNeedsAction; }
+
+    virtual MsgId getId() const noexcept override { return mContent.mId; }
+
+private:
+    struct RawMessage<TheData> mContent;
+
+    bool mNeedsAction;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 class EncoderUpdateMsg : public SerialMessage
 {
 public:
-    using TheData = std::tuple<int, int, std::uint32_t>;
+    // Wheel speeds (raw units, see TelemetryUnits) and distances (edges
+    // since the Pico started) from Odometry, and time of the nav tick
+    using TheData = std::tuple<std::uint16_t, std::uint16_t, std::uint32_t, std::uint32_t,
+                               std::uint32_t>;
 
-    enum class Side : int
-    {
-        kLeft = 0,
-        kRight = 1
-    };
+    static constexpr std::size_t kWireSize{ RawMessage<TheData>::kWireSize };
 
     EncoderUpdateMsg() noexcept;
     explicit EncoderUpdateMsg( TheData t ) noexcept;
-    EncoderUpdateMsg( Side side, int count, std::uint32_t time ) noexcept;
+    EncoderUpdateMsg( std::uint16_t leftSpeed, std::uint16_t rightSpeed,
+                      std::uint32_t leftDistance, std::uint32_t rightDistance,
+                      std::uint32_t time ) noexcept;
     explicit EncoderUpdateMsg( MsgId id );
 
+    float getLeftSpeed() const noexcept
+    {
+        return TelemetryUnits::rawEncoderSpeedToEdgesPerSec( std::get<0>( mContent.mMsg ) );
+    }
+
+    float getRightSpeed() const noexcept
+    {
+        return TelemetryUnits::rawEncoderSpeedToEdgesPerSec( std::get<1>( mContent.mMsg ) );
+    }
+
     virtual void readIn( SerialLink& link ) override;
 
     virtual void sendOut( SerialLink& link ) override;
@@ -577,13 +797,133 @@ private:
 class BatteryLevelUpdateMsg : public SerialMessage
 {
 public:
-    using TheData = std::tuple<std::uint8_t, float>;
+    // Which battery and raw ADC counts (see TelemetryUnits.h)
+    using TheData = std::tuple<std::uint8_t, std::uint16_t>;
 
     BatteryLevelUpdateMsg() noexcept;
     explicit BatteryLevelUpdateMsg( TheData t ) noexcept;
-    BatteryLevelUpdateMsg( Battery whichBattery, float level ) noexcept;
+    BatteryLevelUpdateMsg( Battery whichBattery, std::uint16_t rawCounts ) noexcept;
     explicit BatteryLevelUpdateMsg( MsgId id );
 
+    float getVolts() const noexcept
+    {
+        return static_cast<Battery>( std::get<0>( mContent.mMsg ) ) == Battery::kMotorBattery
+                   ? TelemetryUnits::rawMotorBatteryToVolts( std::get<1>( mContent.mMsg ) )
+                   : TelemetryUnits::rawIcBatteryToVolts( std::get<1>( mContent.mMsg ) );
+    }
+
+    virtual void readIn( SerialLink& link ) override;
+
+    virtual void sendOut( SerialLink& link ) override;
+
+    virtual void takeAction( EventManager& events, SerialLink& link ) override;
+
+    [[nodiscard]] virtual bool needsAction() const noexcept override { return mNeedsAction; }
+
+    virtual MsgId getId() const noexcept override { return mContent.mId; }
+
+private:
+    struct RawMessage<TheData> mContent;
+
+    bool mNeedsAction;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class EventStatsRequestMsg : public SerialMessage
+{
+public:
+    using TheData = std::tuple<std::uint8_t>;
+
+    EventStatsRequestMsg() noexcept;
+    explicit EventStatsRequestMsg( TheData t ) noexcept;
+    explicit EventStatsRequestMsg( bool resetAfter ) noexcept;
+    explicit EventStatsRequestMsg( MsgId id );
+
+    virtual void readIn( SerialLink& link ) override;
+
+    virtual void sendOut( SerialLink& link ) override;
+
+    virtual void takeAction( EventManager& events, SerialLink& link ) override;
+
+    [[nodiscard]] virtual bool needsAction() const noexcept override { return mNeedsAction; }
+
+    virtual MsgId getId() const noexcept override { return mContent.mId; }
+
+private:
+    struct RawMessage<TheData> mContent;
+
+    bool mNeedsAction;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// For the event stats message classes
+enum class EventStatsKind : std::uint8_t
+{
+    kQueueLatency,
+    kExecutionTime,
+};
+
+// Histogram bucket i counts samples < 16 * 4^i us; the last bucket
+// catches everything >= 65.536 ms
+inline constexpr int kEventStatsNbrBuckets{ 8 };
+
+using EventStatsCounts = std::array<std::uint32_t, kEventStatsNbrBuckets>;
+
+////////////////////////////////////////////////////////////////////////////////
+
+class EventStatsMsg : public SerialMessage
+{
+public:
+    using TheData = std::tuple<std::uint8_t, std::uint8_t, std::uint32_t, std::uint32_t,
+                               std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t,
+                               std::uint32_t, std::uint32_t, std::uint32_t>;
+
+    EventStatsMsg() noexcept;
+    explicit EventStatsMsg( TheData t ) noexcept;
+    EventStatsMsg( std::uint8_t evtId, EventStatsKind kind, std::uint32_t maxUs,
+                   const EventStatsCounts& counts ) noexcept;
+    explicit EventStatsMsg( MsgId id );
+
+    virtual void readIn( SerialLink& link ) override;
+
+    virtual void sendOut( SerialLink& link ) override;
+
+    virtual void takeAction( EventManager& events, SerialLink& link ) override;
+
+    [[nodiscard]] virtual bool needsAction() const noexcept override { return mNeedsAction; }
+
+    virtual MsgId getId() const noexcept override { return mContent.mId; }
+
+    EventStatsCounts getCounts() const noexcept
+    {
+        return std::apply( []( auto, auto, auto, auto... counts )
+                           { return EventStatsCounts{ counts... }; },
+                           mContent.mMsg );
+    }
+
+private:
+    struct RawMessage<TheData> mContent;
+
+    bool mNeedsAction;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class MemoryStatsMsg : public SerialMessage
+{
+public:
+    using TheData = std::tuple<std::uint32_t, std::uint32_t, std::uint32_t, std::uint16_t,
+                               std::uint16_t, std::uint32_t>;
+
+    MemoryStatsMsg() noexcept;
+    explicit MemoryStatsMsg( TheData t ) noexcept;
+    MemoryStatsMsg( std::uint32_t heapUsed, std::uint32_t heapHighWater, std::uint32_t heapFree,
+                    std::uint16_t core0StackFree, std::uint16_t core1StackFree,
+                    std::uint32_t time ) noexcept;
+    explicit MemoryStatsMsg( MsgId id );
+
     virtual void readIn( SerialLink& link ) override;
 
     virtual void sendOut( SerialLink& link ) override;
@@ -0,0 +1,106 @@
+/*
+    TelemetryUnits.h - Wire units for telemetry sent from the Pico to the
+    RPi0 and conversions to engineering units.  This file is shared by both
+    the RPI and Pico code bases.
+
+    Copyright (c) 2026 Igor Mikolic-Torreira.  All right reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TelemetryUnits_h
+#define TelemetryUnits_h
+
+#include <cstdint>
+
+/*
+    The Pico's Cortex-M0+ has no FPU, so the Pico sends sensor values in the
+    sensors' own integer units and leaves conversion to the RPi0.  The
+    conversion functions are here so both sides agree on the units, but the
+    Pico should only need them in test code.
+*/
+
+namespace TelemetryUnits
+{
+
+    // BNO055 angles (default units): 16 LSB = 1 degree
+    constexpr int kRawAngleLsbPerDegree{ 16 };
+
+    // BNO055 angular rates (default units): 16 LSB = 1 degree/second
+    constexpr int kRawGyroLsbPerDps{ 16 };
+
+    // BNO055 linear acceleration (default units): 100 LSB = 1 m/s^2
+    constexpr int kRawAccelLsbPerMps2{ 100 };
+
+    // BNO055 quaternion: 2^14 LSB = 1 (unit quaternion)
+    constexpr int kRawQuatLsbPerUnit{ 1 << 14 };
+
+    // Wheel speed from the encoders: 16 LSB = 1 edge/second (the RPi0
+    // knows the wheel and encoder geometry to turn edges into distance)
+    constexpr int kRawEncoderSpeedLsbPerEdgePerSec{ 16 };
+
+    // Dead reckoned position: 256 LSB = 1 encoder edge
+    constexpr int kRawPositionLsbPerEdge{ 256 };
+
+    // Pico ADC: 12 bits against a 3.3V reference
+    constexpr int kAdcBits{ 12 };
+    constexpr float kAdcVoltsPerCount{ 3.3f / ( 1 << kAdcBits ) };
+
+    // Battery voltage dividers on the CARRT board
+    constexpr float kIcVoltageDividerFactor{ ( 39.f + 68.f ) / 68.f };
+    constexpr float kMotorVoltageDividerFactor{ ( 180.f + 82.f ) / 82.f };
+
+    constexpr float rawAngleToDegrees( std::int16_t raw )
+    {
+        return static_cast<float>( raw ) / kRawAngleLsbPerDegree;
+    }
+
+    constexpr float rawGyroToDps( std::int16_t raw )
+    {
+        return static_cast<float>( raw ) / kRawGyroLsbPerDps;
+    }
+
+    constexpr float rawAccelToMps2( std::int16_t raw )
+    {
+        return static_cast<float>( raw ) / kRawAccelLsbPerMps2;
+    }
+
+    constexpr float rawQuatToUnit( std::int16_t raw )
+    {
+        return static_cast<float>( raw ) / kRawQuatLsbPerUnit;
+    }
+
+    constexpr float rawEncoderSpeedToEdgesPerSec( std::uint16_t raw )
+    {
+        return static_cast<float>( raw ) / kRawEncoderSpeedLsbPerEdgePerSec;
+    }
+
+    constexpr float rawPositionToEdges( std::int32_t raw )
+    {
+        return static_cast<float>( raw ) / kRawPositionLsbPerEdge;
+    }
+
+    constexpr float rawIcBatteryToVolts( std::uint16_t counts )
+    {
+        return kIcVoltageDividerFactor * kAdcVoltsPerCount * counts;
+    }
+
+    constexpr float rawMotorBatteryToVolts( std::uint16_t counts )
+    {
+        return kMotorVoltageDividerFactor * kAdcVoltsPerCount * counts;
+    }
+
+};    // namespace TelemetryUnits
+
+#endif    // TelemetryUnits_h